@@ -67,6 +67,9 @@ public:
 protected:
 	const ArchivedFileInfo *		getArchivedFileInfo(const AsciiString& filename) const;	///< return the ArchivedFileInfo from the directory tree.
 
+	typedef std::hash_map<AsciiString, const ArchivedFileInfo*, rts::hash<AsciiString>, rts::equal_to<AsciiString> > ArchivedFileInfoIndex;
+
 	File *m_file; ///< file pointer to the archive file on disk.  Kept open so we don't have to continuously open and close the file all the time.
 	DetailedArchivedDirectoryInfo m_rootDirectory;
+	ArchivedFileInfoIndex m_fileInfoIndex; ///< TheSuperHackers @performance files of m_rootDirectory by ArchiveFileSystem::makeArchivedFileKey
 };
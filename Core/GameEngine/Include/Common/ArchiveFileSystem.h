@@ -104,6 +104,15 @@ public:
 	ArchivedFileInfoMap								m_files;
 };
 
+// TheSuperHackers @performance All locations of one archived file, see ArchiveFileSystem::m_fileIndex
+struct ArchivedFileLocations
+{
+	ArchivedFileLocationMap::iterator first;	///< first location in ArchivedDirectoryInfo::m_files, which is the one with the highest priority
+	UnsignedInt count;												///< number of locations, which follow each other in m_files
+};
+
+typedef std::hash_map<AsciiString, ArchivedFileLocations, rts::hash<AsciiString>, rts::equal_to<AsciiString> > ArchivedFileIndex; // Archived file key to its locations
+
 class ArchivedFileInfo
 {
 public:
@@ -153,6 +162,10 @@ public:
 
 	ArchivedDirectoryInfo* friend_getArchivedDirectoryInfo(const Char* directory);
 
+	/// Normalize a file path the way the directory trees resolve it: lower case, backslash separated,
+	/// and cut off after the token with the last dot, which is the file name.
+	static void makeArchivedFileKey(const Char* filename, AsciiString& key);
+
 protected:
 	struct ArchivedDirectoryInfoResult
 	{
@@ -169,6 +182,11 @@ protected:
 
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+
+	// TheSuperHackers @performance Resolves file lookups with one hash lookup instead of walking
+	// m_rootDirectory token by token. The sorted m_files of each directory stay the owner of the
+	// locations and their priority, so W3DFileSystem::reprioritizeTexturesBySize still applies.
+	ArchivedFileIndex m_fileIndex;
 };
 
 
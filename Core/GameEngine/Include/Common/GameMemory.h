@@ -176,6 +176,13 @@
 
 #endif // MEMORYPOOL_DEBUG
 
+// TheSuperHackers @performance Each thread keeps a few free blocks per pool, so most allocations and
+// frees do not need to take TheMemoryPoolCriticalSection. With MEMORYPOOL_DEBUG the cache is used as
+// well, but the debug bookkeeping of each block still takes the lock.
+#if !defined(DISABLE_MEMORYPOOL_THREAD_CACHE)
+	#define MEMORYPOOL_THREAD_CACHE
+#endif
+
 // TheSuperHackers @build xezon 30/03/2025 Define DISABLE_GAMEMEMORY to use a null implementations for Game Memory.
 // Useful for address sanitizer checks and other investigations.
 // Is included below the macros so that memory pool debug code can still be used.
@@ -221,6 +228,7 @@ class MemoryPoolSingleBlock;
 class MemoryPoolBlob;
 class MemoryPool;
 class MemoryPoolFactory;
+struct MemoryPoolThreadCacheSlot;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
 
@@ -243,7 +251,9 @@ struct PoolInitRec
 
 enum
 {
-	MAX_DYNAMICMEMORYALLOCATOR_SUBPOOLS = 8	///< The max number of subpools allowed in a DynamicMemoryAllocator
+	MAX_DYNAMICMEMORYALLOCATOR_SUBPOOLS = 8,	///< The max number of subpools allowed in a DynamicMemoryAllocator
+	DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES = 4,	///< granularity of the DynamicMemoryAllocator size class table
+	MAX_DYNAMICMEMORYALLOCATOR_SIZECLASSES = 1024 / DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES + 1	///< sizes up to 1024 bytes are looked up in the table
 };
 
 #ifdef MEMORYPOOL_CHECKPOINTING
@@ -303,9 +313,18 @@ private:
 	Int								m_usedBlocksInPool;					///< total number of blocks in use in the pool.
 	Int								m_totalBlocksInPool;				///< total number of blocks in all blobs of this pool (used or not).
 	Int								m_peakUsedBlocksInPool;			///< high-water mark of m_usedBlocksInPool
+	UnsignedInt				m_allocationCount;					///< number of blocks handed out since this pool was created
+	UnsignedInt				m_freeCount;								///< number of blocks given back since this pool was created
+	Int								m_overflowBlobCount;				///< number of blobs created because the existing blobs were full
+	UnsignedInt				m_reportedAllocationCount;	///< m_allocationCount at the last telemetry report
+	UnsignedInt				m_reportedFreeCount;				///< m_freeCount at the last telemetry report
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+#ifdef MEMORYPOOL_THREAD_CACHE
+	Int								m_threadCacheSlot;					///< index of this pool in the thread caches, or -1 if it is not cached
+	volatile Int			m_threadCacheGeneration;		///< incremented when all blocks cached by threads become invalid
+#endif
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -314,12 +333,37 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// allocate a block from the blobs. TheMemoryPoolCriticalSection must be held.
+	void *allocateBlockFromBlobs(DECLARE_LITERALSTRING_ARG1);
+
+	/// free a block back to its blob. TheMemoryPoolCriticalSection must be held.
+	void freeBlockToBlob(void *pBlockPtr);
+
+	/// put a block back on the free list of its blob, without the debug bookkeeping. TheMemoryPoolCriticalSection must be held.
+	void returnBlockToBlob(MemoryPoolSingleBlock *block);
+
+#ifdef MEMORYPOOL_DEBUG
+	void debugBlockAllocated(MemoryPoolSingleBlock *block DECLARE_LITERALSTRING_ARG2);	///< debug bookkeeping for a block that is handed out
+	void debugBlockFreed(MemoryPoolSingleBlock *block);		///< debug bookkeeping for a block that is given back
+#endif
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+	/// return the cache of this pool for the calling thread, or null if this pool is not cached
+	MemoryPoolThreadCacheSlot *getThreadCacheSlot();
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
 	MemoryPool *getNextPoolInList();					///< return next pool in linked list
 	void addToList(MemoryPool **pHead);				///< add this pool to head of the linked list
 	void removeFromList(MemoryPool **pHead);	///< remove this pool from the linked list
+	void telemetryReport(FILE *fp, const char *label, UnsignedInt frame);	///< write a CSV line with the counters of this pool
+	#ifdef MEMORYPOOL_THREAD_CACHE
+		void flushThreadCache();										///< return the blocks the calling thread cached for this pool. TheMemoryPoolCriticalSection must be held.
+		void flushThreadCacheSlot(MemoryPoolThreadCacheSlot *slot);	///< return the blocks in one thread's cache slot for this pool. TheMemoryPoolCriticalSection must be held.
+		void removeFromThreadCaches();							///< return the blocks all threads cached for this pool before it is destroyed. TheMemoryPoolCriticalSection must be held.
+	#endif
 	#ifdef MEMORYPOOL_DEBUG
 		static void debugPoolInfoReport( MemoryPool *pool, FILE *fp = nullptr );	///< dump a report about this pool to the logfile
 		const char *debugGetBlockTagString(void *pBlock);		///< return the tagstring for the given block (assumed to belong to this pool)
@@ -372,6 +416,15 @@ public:
 	/// return the initial allocation count for this pool
 	Int getInitialBlockCount();
 
+	/// return the number of blocks allocated from this pool since it was created
+	UnsignedInt getAllocationCount();
+
+	/// return the number of blocks freed to this pool since it was created
+	UnsignedInt getFreeCount();
+
+	/// return the number of times this pool had to grow beyond its initial blob
+	Int getOverflowBlobCount();
+
 	Int countBlobsInPool();
 
 	/// if this pool has any empty blobs, return them to the system.
@@ -406,6 +459,7 @@ private:
 	Int												m_usedBlocksInDma;		///< total number of blocks allocated, from subpools and "raw"
 	MemoryPool								*m_pools[MAX_DYNAMICMEMORYALLOCATOR_SUBPOOLS];	///< the subpools
 	MemoryPoolSingleBlock			*m_rawBlocks;					///< linked list of "raw" blocks allocated directly from system
+	UnsignedByte							m_poolForSizeClass[MAX_DYNAMICMEMORYALLOCATOR_SIZECLASSES];	///< TheSuperHackers @performance 1 + index of the best subpool per size class, or 0 if none fits
 
 	/// return the best pool for the given allocSize, or null if none are suitable
 	MemoryPool *findPoolForSize(Int allocSize);
@@ -547,6 +601,9 @@ public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
 
+	/// append one CSV line per pool that allocated or freed blocks since the last call.
+	void memoryPoolTelemetryReport( FILE *fp, const char *label, UnsignedInt frame );
+
 	#ifdef MEMORYPOOL_DEBUG
 
 		/// perform internal consistency checking
@@ -780,6 +837,9 @@ inline Int MemoryPool::getFreeBlockCount() { return getTotalBlockCount() - getUs
 inline Int MemoryPool::getUsedBlockCount() { return m_usedBlocksInPool; }
 inline Int MemoryPool::getTotalBlockCount() { return m_totalBlocksInPool; }
 inline Int MemoryPool::getPeakBlockCount() { return m_peakUsedBlocksInPool; }
+inline UnsignedInt MemoryPool::getAllocationCount() { return m_allocationCount; }
+inline UnsignedInt MemoryPool::getFreeCount() { return m_freeCount; }
+inline Int MemoryPool::getOverflowBlobCount() { return m_overflowBlobCount; }
 inline Int MemoryPool::getInitialBlockCount() { return m_initialAllocationCount; }
 
 // ----------------------------------------------------------------------------
@@ -65,6 +65,7 @@ class MemoryPoolFactory
 public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
+	void memoryPoolTelemetryReport( FILE *fp, const char *label, UnsignedInt frame );
 
 #ifdef MEMORYPOOL_DEBUG
 
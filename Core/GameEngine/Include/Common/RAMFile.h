@@ -75,6 +75,7 @@ class RAMFile : public File
 		Char				*m_data;											///< File data in memory
 		Int					m_pos;												///< current read position
 		Int					m_size;												///< size of file in memory
+		Bool				m_ownsData;										///< FALSE if m_data is a view into memory owned by someone else
 
 	public:
 
@@ -102,6 +103,7 @@ class RAMFile : public File
 
 		virtual Bool	open( File *file );																	///< Open file for fast RAM access
 		virtual Bool	openFromArchive(File *archiveFile, const AsciiString& filename, Int offset, Int size); ///< copy file data from the given file at the given offset for the given size.
+		Bool					openView(const AsciiString& filename, const Char *data, Int size);	///< read only view of memory that outlives this file, nothing is copied
 		virtual Bool	copyDataToFile(File *localFile);										///< write the contents of the RAM file to the given local file.  This could be REALLY slow.
 
 		/**
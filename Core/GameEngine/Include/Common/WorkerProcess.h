@@ -30,6 +30,10 @@ public:
 
 	void update();
 
+	// TheSuperHackers @performance Block until any of the running processes exits or the timeout
+	// elapses, instead of sleeping for a fixed time. Call update() on all processes afterwards.
+	static void waitForAny(const std::vector<WorkerProcess>& processes, DWORD timeoutMillis);
+
 	bool isRunning() const;
 
 	// returns true iff the process exited.
@@ -38,6 +42,12 @@ public:
 	DWORD getExitCode() const;
 	AsciiString getStdOutput() const;
 
+	// valid once the process is done
+	DWORD getWallTimeMillis() const { return m_wallTimeMillis; }
+
+	// peak memory of the process so far, or 0 if unknown
+	SIZE_T getPeakMemoryUsed() const;
+
 	// Terminate Process if it's running
 	void kill();
 
@@ -52,5 +62,8 @@ private:
 	HANDLE m_jobHandle;
 	AsciiString m_stdOutput;
 	DWORD m_exitcode;
+	DWORD m_startTimeMillis;
+	DWORD m_wallTimeMillis;
+	SIZE_T m_peakMemoryUsed;
 	bool m_isDone;
 };
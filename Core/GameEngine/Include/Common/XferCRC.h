@@ -57,12 +57,20 @@ public:
 	// Xfer CRC methods
 	virtual UnsignedInt getCRC( void );										///< get computed CRC in network byte order
 
+	// TheSuperHackers @performance Step recording for the incremental logic CRC. While recording,
+	// every value added to the CRC is also appended to the given list, so it can be replayed later
+	// with addCRCSteps() without traversing the snapshot again.
+	void setStepRecording( std::vector<UnsignedInt> *steps ) { m_stepRecording = steps; }
+	void addCRCSteps( const UnsignedInt *steps, Int count );	///< replay previously recorded CRC steps
+
 protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );
 
 	inline void addCRC( UnsignedInt val );								///< CRC a 4-byte block
+	void recordImplementation( const void *data, Int dataSize );	///< xferImplementation while recording steps
 
 	UnsignedInt m_crc;
+	std::vector<UnsignedInt> *m_stepRecording;						///< if not null, every CRC step is appended here
 
 };
@@ -61,6 +61,11 @@ protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
 
+	Bool readData( void *data, Int dataSize );							///< read from the buffer, refilling it from the file as needed
+
 	FILE * m_fileFP;																					///< pointer to file
+	std::vector<UnsignedByte> m_buffer;												///< data read ahead from the file
+	Int m_bufferPos;																					///< position of the next unread byte in m_buffer
+	Int m_bufferEnd;																					///< number of valid bytes in m_buffer
 
 };
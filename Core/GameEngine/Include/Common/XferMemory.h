@@ -0,0 +1,47 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: XferMemory.h /////////////////////////////////////////////////////////////////////////////
+// Desc:   Xfer write implementation that collects the data in memory
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Common/XferSave.h"
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Writes snapshots in the same format as XferSave, but into a memory
+	* buffer instead of a file, so that game state can be captured without touching the disk */
+//-------------------------------------------------------------------------------------------------
+class XferMemorySave : public XferBufferedSave
+{
+
+public:
+
+	XferMemorySave( void );
+	virtual ~XferMemorySave( void );
+
+	// Xfer methods
+	virtual void open( AsciiString identifier );		///< start collecting data, identifier is only a label
+	virtual void close( void );											///< stop collecting data, the buffer is kept
+
+	const std::vector<UnsignedByte> &getBuffer( void ) const { return m_buffer; }	///< the data written so far
+	void swapBuffer( std::vector<UnsignedByte> &buffer ) { m_buffer.swap( buffer ); }	///< take the data without copying it
+
+};
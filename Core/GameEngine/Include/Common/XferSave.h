@@ -40,21 +40,22 @@ class Snapshot;
 typedef long XferFilePos;
 
 //-------------------------------------------------------------------------------------------------
+/** Collects the written data in memory, so the block sizes can be
+	* patched in place. XferSave writes the buffer to a file each time the outermost block ends,
+	* XferMemorySave keeps it */
 //-------------------------------------------------------------------------------------------------
-class XferSave : public Xfer
+class XferBufferedSave : public Xfer
 {
 
 public:
 
-	XferSave( void );
-	virtual ~XferSave( void );
+	XferBufferedSave( void );
+	virtual ~XferBufferedSave( void );
 
 	// Xfer methods
-	virtual void open( AsciiString identifier );		///< open file for writing
-	virtual void close( void );											///< close file
 	virtual Int beginBlock( void );									///< write placeholder block size
-	virtual void endBlock( void );									///< backup to last begin block and write size
-	virtual void skip( Int dataSize );							///< skipping during a write is a no-op
+	virtual void endBlock( void );									///< patch the size of the last begin block
+	virtual void skip( Int dataSize );							///< write dataSize zero bytes
 
 	virtual void xferSnapshot( Snapshot *snapshot );		///< entry point for xfering a snapshot
 
@@ -66,7 +67,34 @@ protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );		///< the xfer implementation
 
-	FILE * m_fileFP;																			///< pointer to file
+	virtual void flushBuffer( void ) { }									///< called when the outermost block has ended
+	void clearBlockStack( void );														///< delete the block stack
+
+	Bool m_isOpen;																				///< open was called without a matching close
 	XferBlockData *m_blockStack;													///< stack of block data
+	std::vector<UnsignedByte> m_buffer;										///< the data written so far
+
+};
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+class XferSave : public XferBufferedSave
+{
+
+public:
+
+	XferSave( void );
+	virtual ~XferSave( void );
+
+	// Xfer methods
+	virtual void open( AsciiString identifier );		///< open file for writing
+	virtual void close( void );											///< close file
+	void abandon( void );														///< close file without writing buffered data, never throws
+
+protected:
+
+	virtual void flushBuffer( void );												///< write the buffered data to the file
+
+	FILE * m_fileFP;																			///< pointer to file
 
 };
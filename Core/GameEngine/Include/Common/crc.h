@@ -72,23 +72,22 @@ public:
       return;
 
 #if !(defined(_MSC_VER) && _MSC_VER < 1300)
-    // C++ version left in for reference purposes
-	  for (UnsignedByte *uintPtr=(UnsignedByte *)buf;len>0;len--,uintPtr++)
+    // TheSuperHackers @performance Rotate and add in a local, unrolled by four bytes. Each step depends
+    // on the previous one through the carries of the add, so the bytes cannot be summed in parallel.
+    UnsignedInt c = crc;
+    const UnsignedByte *uintPtr = (const UnsignedByte *)buf;
+    for (; len >= 4; len -= 4, uintPtr += 4)
     {
-    	int hibit;
-    	if (crc & 0x80000000)
-      {
-		    hibit = 1;
-	    }
-      else
-      {
-		    hibit = 0;
-	    }
-
-	    crc <<= 1;
-	    crc += *uintPtr;
-	    crc += hibit;
+      c = ((c << 1) | (c >> 31)) + uintPtr[0];
+      c = ((c << 1) | (c >> 31)) + uintPtr[1];
+      c = ((c << 1) | (c >> 31)) + uintPtr[2];
+      c = ((c << 1) | (c >> 31)) + uintPtr[3];
     }
+    for (; len > 0; len--, uintPtr++)
+    {
+      c = ((c << 1) | (c >> 31)) + *uintPtr;
+    }
+    crc = c;
 #else
     // ASM version, verified by comparing resulting data with C++ version data
     unsigned *crcPtr=&crc;
@@ -21,10 +21,13 @@
 #include "Common/ReplaySimulation.h"
 
 #include "Common/GameEngine.h"
+#include "Common/GameState.h"
 #include "Common/LocalFileSystem.h"
 #include "Common/Recorder.h"
 #include "Common/WorkerProcess.h"
+#include "Common/XferMemory.h"
 #include "GameLogic/GameLogic.h"
+#include "GameLogic/ScriptEngine.h"
 #include "GameClient/GameClient.h"
 
 
@@ -34,17 +37,262 @@ UnsignedInt ReplaySimulation::s_replayCount = 0;
 
 namespace
 {
-int countProcessesRunning(const std::vector<WorkerProcess>& processes)
+// Prefix of the line a worker prints after each replay, so the parent can pick up the results
+const char *const ReplayResultPrefix = "Replay Result:";
+
+// CreateProcess takes command lines of up to 32767 characters, including the terminating null
+const int MaxCommandLineLength = 32767;
+
+void printReplayResult(Int frames, Int mismatchFrame, Int scheduleMismatches, DWORD wallTimeMillis)
+{
+	printf("%s Frames %d CRC Mismatch Frame %d Script Schedule Mismatches %d Wall Time %u\n", ReplayResultPrefix, frames, mismatchFrame,
+		scheduleMismatches, (UnsignedInt)wallTimeMillis);
+	fflush(stdout);
+}
+
+// Parse a line written by printReplayResult, returns false if it is not one
+Bool parseReplayResult(const char *line, Int &frames, Int &mismatchFrame, Int &scheduleMismatches, DWORD &wallTimeMillis)
+{
+	const size_t prefixLength = strlen(ReplayResultPrefix);
+	if (strncmp(line, ReplayResultPrefix, prefixLength) != 0)
+		return false;
+
+	UnsignedInt wallTime = 0;
+	if (sscanf(line + prefixLength, " Frames %d CRC Mismatch Frame %d Script Schedule Mismatches %d Wall Time %u", &frames, &mismatchFrame,
+		&scheduleMismatches, &wallTime) != 4)
+		return false;
+
+	wallTimeMillis = wallTime;
+	return true;
+}
+
+FILE *openReplayResultsFile()
 {
-	int numProcessesRunning = 0;
-	size_t i = 0;
-	for (; i < processes.size(); ++i)
+	if (TheGlobalData->m_simulateReplayResultsFile.isEmpty())
+		return nullptr;
+
+	FILE *fp = fopen(TheGlobalData->m_simulateReplayResultsFile.str(), "w");
+	if (fp == nullptr)
+		printf("Cannot open replay results file \"%s\"\n", TheGlobalData->m_simulateReplayResultsFile.str());
+	return fp;
+}
+
+// Write one replay result as a single line of JSON. Negative values are written as null.
+void writeReplayResult(FILE *fp, const AsciiString &filename, DWORD exitcode, Int frames, Int mismatchFrame,
+	Int scheduleMismatches, DWORD wallTimeMillis, Int64 peakMemoryUsed)
+{
+	if (fp == nullptr)
+		return;
+
+	fprintf(fp, "{\"replay\":\"");
+	for (const char *c = filename.str(); *c; ++c)
 	{
-		if (processes[i].isRunning())
-			++numProcessesRunning;
+		if (*c == '\\' || *c == '"')
+			fputc('\\', fp);
+		fputc(*c, fp);
 	}
-	return numProcessesRunning;
+	fprintf(fp, "\",\"exitCode\":%u", (UnsignedInt)exitcode);
+
+	if (frames >= 0)
+		fprintf(fp, ",\"frames\":%d", frames);
+	else
+		fprintf(fp, ",\"frames\":null");
+
+	fprintf(fp, ",\"wallTimeMs\":%u", (UnsignedInt)wallTimeMillis);
+
+	if (mismatchFrame >= 0)
+		fprintf(fp, ",\"crcMismatchFrame\":%d", mismatchFrame);
+	else
+		fprintf(fp, ",\"crcMismatchFrame\":null");
+
+	if (scheduleMismatches >= 0)
+		fprintf(fp, ",\"scriptScheduleMismatches\":%d", scheduleMismatches);
+	else
+		fprintf(fp, ",\"scriptScheduleMismatches\":null");
+
+	if (peakMemoryUsed > 0)
+		fprintf(fp, ",\"peakMemoryBytes\":%.0f}\n", (double)peakMemoryUsed);
+	else
+		fprintf(fp, ",\"peakMemoryBytes\":null}\n");
+
+	fflush(fp);
 }
+
+FILE *openMemoryPoolTelemetryFile()
+{
+	if (TheGlobalData->m_memoryPoolTelemetryFile.isEmpty())
+		return nullptr;
+
+	// The file holds the telemetry of this run only, a previous run's rows are discarded
+	FILE *fp = fopen(TheGlobalData->m_memoryPoolTelemetryFile.str(), "w");
+	if (fp == nullptr)
+		printf("Cannot open pool telemetry file \"%s\"\n", TheGlobalData->m_memoryPoolTelemetryFile.str());
+	return fp;
+}
+
+// TheSuperHackers @feature Keeps the logic state of the last few snapshot frames of a replay in
+// memory. When the replay mismatches, or reaches m_simulateReplaySnapshotFrame, they are written to
+// m_simulateReplaySnapshotDir, so the states of two runs (for example two builds) can be compared with
+// the replaysnapshotdiff tool to find the first snapshot interval that diverged, which then only needs
+// to be rerun with CRC logging for that interval.
+// This only captures snapshots, they cannot be loaded back to resume the simulation from them.
+// The newest snapshot is kept whole, each older one as its difference to the next newer one.
+class ReplaySnapshotHistory
+{
+public:
+	enum { MaxSnapshots = 16 };
+
+	void clear()
+	{
+		m_frames.clear();
+		m_deltas.clear();
+		m_newest.clear();
+	}
+
+	void takeSnapshot(UnsignedInt frame)
+	{
+		XferMemorySave xfer;
+		xfer.swapBuffer(m_scratch);
+		xfer.open("ReplaySnapshot");
+		TheGameState->friend_xferSaveDataForCRC(&xfer, SNAPSHOT_DEEPCRC_LOGICONLY);
+		xfer.close();
+		xfer.swapBuffer(m_scratch);
+
+		if (!m_frames.empty())
+		{
+			if (m_frames.size() == MaxSnapshots)
+			{
+				m_frames.erase(m_frames.begin());
+				m_deltas.erase(m_deltas.begin());
+			}
+			m_deltas.push_back(std::vector<UnsignedByte>());
+			encodeDelta(m_newest, m_scratch, m_deltas.back());
+#if defined(RTS_DEBUG)
+			std::vector<UnsignedByte> decoded;
+			decodeDelta(m_scratch, m_deltas.back(), decoded);
+			DEBUG_ASSERTCRASH(decoded == m_newest, ("Replay snapshot delta of frame %u does not decode to the snapshot", m_frames.back()));
+#endif
+		}
+		m_frames.push_back(frame);
+		m_newest.swap(m_scratch);
+	}
+
+	// Write all snapshots as "<dir>\<replay>_<frame>.snapshot", returns the number of files written
+	Int write(const AsciiString &dir, const AsciiString &replayFilename) const
+	{
+		if (m_frames.empty())
+			return 0;
+
+		CreateDirectory(dir.str(), nullptr);
+
+		const char *separator = replayFilename.reverseFind('\\');
+		const char *slash = replayFilename.reverseFind('/');
+		if (slash != nullptr && (separator == nullptr || slash > separator))
+			separator = slash;
+		AsciiString leaf = separator != nullptr ? separator + 1 : replayFilename.str();
+		if (leaf.endsWithNoCase(".rep"))
+			leaf.truncateBy(4);
+
+		Int written = 0;
+		std::vector<UnsignedByte> snapshot = m_newest;
+		std::vector<UnsignedByte> older;
+		for (size_t i = m_frames.size(); i-- > 0; )
+		{
+			AsciiString path;
+			path.format("%s\\%s_%06u.snapshot", dir.str(), leaf.str(), m_frames[i]);
+			FILE *fp = fopen(path.str(), "wb");
+			if (fp != nullptr)
+			{
+				if (snapshot.empty() || fwrite(&snapshot[0], snapshot.size(), 1, fp) == 1)
+					written++;
+				fclose(fp);
+			}
+
+			if (i > 0)
+			{
+				decodeDelta(snapshot, m_deltas[i - 1], older);
+				snapshot.swap(older);
+			}
+		}
+		return written;
+	}
+
+private:
+	// Describe 'older' relative to 'newer' as runs of (equal byte count, changed byte count, changed bytes),
+	// preceded by the size of 'older'
+	static void encodeDelta(const std::vector<UnsignedByte> &older, const std::vector<UnsignedByte> &newer, std::vector<UnsignedByte> &delta)
+	{
+		const UnsignedInt olderSize = (UnsignedInt)older.size();
+		const UnsignedInt commonSize = (UnsignedInt)min(older.size(), newer.size());
+		appendUnsignedInt(delta, olderSize);
+
+		UnsignedInt i = 0;
+		while (i < olderSize)
+		{
+			UnsignedInt equalStart = i;
+			while (i < commonSize && older[i] == newer[i])
+				++i;
+			UnsignedInt changedStart = i;
+			while (i < olderSize && (i >= commonSize || older[i] != newer[i]))
+				++i;
+
+			appendUnsignedInt(delta, changedStart - equalStart);
+			appendUnsignedInt(delta, i - changedStart);
+			delta.insert(delta.end(), older.begin() + changedStart, older.begin() + i);
+		}
+	}
+
+	static void decodeDelta(const std::vector<UnsignedByte> &newer, const std::vector<UnsignedByte> &delta, std::vector<UnsignedByte> &older)
+	{
+		size_t pos = 0;
+		const UnsignedInt olderSize = readUnsignedInt(delta, pos);
+		older.resize(olderSize);
+
+		UnsignedInt i = 0;
+		while (i < olderSize)
+		{
+			const UnsignedInt equalCount = readUnsignedInt(delta, pos);
+			const UnsignedInt changedCount = readUnsignedInt(delta, pos);
+			if (equalCount > 0)
+				memcpy(&older[i], &newer[i], equalCount);
+			i += equalCount;
+			if (changedCount > 0)
+				memcpy(&older[i], &delta[pos], changedCount);
+			i += changedCount;
+			pos += changedCount;
+		}
+	}
+
+	static void appendUnsignedInt(std::vector<UnsignedByte> &buffer, UnsignedInt value)
+	{
+		const UnsignedByte *bytes = reinterpret_cast<const UnsignedByte *>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+	}
+
+	static UnsignedInt readUnsignedInt(const std::vector<UnsignedByte> &buffer, size_t &pos)
+	{
+		UnsignedInt value;
+		memcpy(&value, &buffer[pos], sizeof(value));
+		pos += sizeof(value);
+		return value;
+	}
+
+	std::vector<UnsignedInt> m_frames;									///< frames of the snapshots, oldest first
+	std::vector<std::vector<UnsignedByte> > m_deltas;		///< m_deltas[i] turns snapshot i+1 into snapshot i
+	std::vector<UnsignedByte> m_newest;									///< the newest snapshot
+	std::vector<UnsignedByte> m_scratch;								///< reused buffer for taking a snapshot
+};
+
+// A worker process and the replays it simulates, in order
+struct ReplayWorker
+{
+	WorkerProcess process;
+	std::vector<size_t> replayIndices;
+	size_t numResults;				///< replays the worker has reported a result for
+	size_t numFailed;					///< reported replays that failed
+	size_t outputParsed;			///< length of the worker output that was scanned for results
+	size_t outputPrinted;			///< length of the worker output that was printed
+};
 } // namespace
 
 int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames)
@@ -74,6 +322,10 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		return numErrors != 0 ? 1 : 0;
 	}
 	// Note that we use printf here because this is run from cmd.
+	FILE *resultsFile = openReplayResultsFile();
+	FILE *telemetryFile = openMemoryPoolTelemetryFile();
+	const Bool takeSnapshots = !TheGlobalData->m_simulateReplaySnapshotDir.isEmpty();
+	ReplaySnapshotHistory snapshots;
 	DWORD totalStartTimeMillis = GetTickCount();
 	for (size_t i = 0; i < filenames.size(); i++)
 	{
@@ -83,7 +335,10 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		DWORD startTimeMillis = GetTickCount();
 		if (TheRecorder->simulateReplay(filename))
 		{
+			const int numErrorsBefore = numErrors;
 			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
+			// The first report holds everything that was allocated while loading the map
+			TheMemoryPoolFactory->memoryPoolTelemetryReport(telemetryFile, filename.str(), TheGameLogic->getFrame());
 			while (TheRecorder->isPlaybackInProgress())
 			{
 				TheGameClient->updateHeadless();
@@ -99,24 +354,64 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 					fflush(stdout);
 				}
 				TheGameLogic->UPDATE();
+				if (takeSnapshots && TheGameLogic->getFrame() % TheGlobalData->m_simulateReplaySnapshotInterval == 0)
+				{
+					snapshots.takeSnapshot(TheGameLogic->getFrame());
+				}
+				if (telemetryFile != nullptr && TheGameLogic->getFrame() % TheGlobalData->m_memoryPoolTelemetryInterval == 0)
+				{
+					TheMemoryPoolFactory->memoryPoolTelemetryReport(telemetryFile, filename.str(), TheGameLogic->getFrame());
+				}
 				if (TheRecorder->sawCRCMismatch())
 				{
 					numErrors++;
+					if (takeSnapshots)
+					{
+						const Int written = snapshots.write(TheGlobalData->m_simulateReplaySnapshotDir, filename);
+						printf("Wrote %d logic snapshots to \"%s\"\n", written, TheGlobalData->m_simulateReplaySnapshotDir.str());
+					}
+					break;
+				}
+				if (takeSnapshots && TheGlobalData->m_simulateReplaySnapshotFrame > 0
+					&& TheGameLogic->getFrame() >= (UnsignedInt)TheGlobalData->m_simulateReplaySnapshotFrame)
+				{
+					// Capture the frames another run mismatched at, the rest of this replay is skipped
+					const Int written = snapshots.write(TheGlobalData->m_simulateReplaySnapshotDir, filename);
+					printf("Stopped at frame %u, wrote %d logic snapshots to \"%s\"\n", TheGameLogic->getFrame(), written,
+						TheGlobalData->m_simulateReplaySnapshotDir.str());
 					break;
 				}
 			}
+			snapshots.clear();
+			// With -verifyScriptSchedule, a scheduled script that evaluated differently from polling fails the replay
+			const Int scheduleMismatches = TheScriptEngine->getScriptScheduleMismatchCount();
+			if (scheduleMismatches > 0 && numErrors == numErrorsBefore)
+				numErrors++;
+			TheMemoryPoolFactory->memoryPoolTelemetryReport(telemetryFile, filename.str(), TheGameLogic->getFrame());
 			UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
 			UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
 			printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
 					realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
-			fflush(stdout);
+			printReplayResult((Int)TheGameLogic->getFrame(), TheRecorder->getCRCMismatchFrame(), scheduleMismatches, GetTickCount()-startTimeMillis);
+
+			writeReplayResult(resultsFile, filename, numErrors != numErrorsBefore ? 1 : 0, (Int)TheGameLogic->getFrame(),
+				TheRecorder->getCRCMismatchFrame(), scheduleMismatches, GetTickCount()-startTimeMillis, -1);
 		}
 		else
 		{
 			printf("Cannot open replay\n");
+			printReplayResult(-1, -1, -1, GetTickCount()-startTimeMillis);
 			numErrors++;
+
+			writeReplayResult(resultsFile, filename, 1, -1, -1, -1, GetTickCount()-startTimeMillis, -1);
 		}
 	}
+
+	if (resultsFile != nullptr)
+		fclose(resultsFile);
+	if (telemetryFile != nullptr)
+		fclose(telemetryFile);
+
 	if (filenames.size() > 1)
 	{
 		printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
@@ -136,64 +431,217 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	WideChar exePath[1024];
 	GetModuleFileNameW(nullptr, exePath, ARRAY_SIZE(exePath));
 
-	std::vector<WorkerProcess> processes;
-	int filenamePositionStarted = 0;
-	int filenamePositionDone = 0;
+	FILE *resultsFile = openReplayResultsFile();
+
+	// TheSuperHackers @performance A worker simulates up to m_simulateReplaysPerJob replays in a
+	// row, so engine startup (INI, templates, archives) is paid once per batch instead of once per
+	// replay. Workers are waited on with WorkerProcess::waitForAny instead of sleeping, and each
+	// replay is reported as soon as its worker prints its result line, so one slow replay does not
+	// hold back the results of the others.
+	const size_t replaysPerJob = (size_t)TheGlobalData->m_simulateReplaysPerJob;
+
+	std::vector<ReplayWorker> workers;
+	std::vector<WorkerProcess> waitProcesses;
+	size_t filenamePositionStarted = 0;
+	size_t filenamePositionDone = 0;
 	int numErrors = 0;
 
 	while (true)
 	{
-		int i;
-		for (i = 0; i < processes.size(); i++)
-			processes[i].update();
-
-		// Get result of finished processes and print output in order
-		while (!processes.empty())
-		{
-			if (!processes[0].isDone())
-				break;
-			AsciiString stdOutput = processes[0].getStdOutput();
-			printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
-			DWORD exitcode = processes[0].getExitCode();
-			if (exitcode != 0)
-				printf("Error!\n");
-			fflush(stdout);
-			numErrors += exitcode == 0 ? 0 : 1;
-			processes.erase(processes.begin());
-			filenamePositionDone++;
-		}
-
-		int numProcessesRunning = countProcessesRunning(processes);
-
 		// Add new processes when we are below the limit and there are replays left
-		while (numProcessesRunning < maxProcesses && filenamePositionStarted < filenames.size())
+		while (workers.size() < (size_t)maxProcesses && filenamePositionStarted < filenames.size())
 		{
-			UnicodeString filenameWide;
-			filenameWide.translate(filenames[filenamePositionStarted]);
+			ReplayWorker worker;
+			worker.numResults = 0;
+			worker.numFailed = 0;
+			worker.outputParsed = 0;
+			worker.outputPrinted = 0;
+
 			UnicodeString command;
-			command.format(L"\"%s\"%s%s -replay \"%s\"",
+			command.format(L"\"%s\"%s%s",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
-				TheGlobalData->m_headless ? L" -headless" : L"",
-				filenameWide.str());
+				TheGlobalData->m_headless ? L" -headless" : L"");
+
+			// The options follow the replays, but are built first so the batch can be closed before
+			// the command line outgrows what CreateProcess accepts
+			UnicodeString options;
+
+			if (!TheGlobalData->m_simulateReplaySnapshotDir.isEmpty())
+			{
+				UnicodeString snapshotDirWide;
+				snapshotDirWide.translate(TheGlobalData->m_simulateReplaySnapshotDir);
+				UnicodeString snapshotArg;
+				snapshotArg.format(L" -replaySnapshots \"%s\" -replaySnapshotInterval %d", snapshotDirWide.str(),
+					TheGlobalData->m_simulateReplaySnapshotInterval);
+				options.concat(snapshotArg);
+				if (TheGlobalData->m_simulateReplaySnapshotFrame > 0)
+				{
+					snapshotArg.format(L" -replaySnapshotFrame %d", TheGlobalData->m_simulateReplaySnapshotFrame);
+					options.concat(snapshotArg);
+				}
+			}
+
+			if (!TheGlobalData->m_memoryPoolTelemetryFile.isEmpty())
+			{
+				// Each worker writes its own file, named after its first replay
+				UnicodeString telemetryFileWide;
+				telemetryFileWide.translate(TheGlobalData->m_memoryPoolTelemetryFile);
+				UnicodeString telemetryArg;
+				telemetryArg.format(L" -poolTelemetry \"%s.%u\" -poolTelemetryInterval %d", telemetryFileWide.str(),
+					(UnsignedInt)filenamePositionStarted, TheGlobalData->m_memoryPoolTelemetryInterval);
+				options.concat(telemetryArg);
+			}
+
+			if (TheGlobalData->m_incrementalLogicCRC)
+			{
+				options.concat(TheGlobalData->m_validateIncrementalLogicCRC ? L" -validateIncrementalCRC" : L" -incrementalCRC");
+			}
+
+			if (TheGlobalData->m_verifyScriptSchedule)
+			{
+				options.concat(L" -verifyScriptSchedule");
+			}
+
+			while (worker.replayIndices.size() < replaysPerJob && filenamePositionStarted < filenames.size())
+			{
+				UnicodeString filenameWide;
+				filenameWide.translate(filenames[filenamePositionStarted]);
+				UnicodeString replayArg;
+				replayArg.format(L" -replay \"%s\"", filenameWide.str());
+
+				// A single replay always gets a worker, even if its path alone is too long
+				if (!worker.replayIndices.empty() &&
+					command.getLength() + replayArg.getLength() + options.getLength() >= MaxCommandLineLength)
+				{
+					break;
+				}
+				command.concat(replayArg);
 
-			processes.push_back(WorkerProcess());
-			processes.back().startProcess(command);
+				worker.replayIndices.push_back(filenamePositionStarted++);
+			}
+
+			command.concat(options);
 
-			filenamePositionStarted++;
-			numProcessesRunning++;
+			if (!worker.process.startProcess(command))
+			{
+				for (size_t r = 0; r < worker.replayIndices.size(); ++r)
+				{
+					filenamePositionDone++;
+					printf("%d/%d Cannot start worker for replay \"%s\"\nError!\n", (int)filenamePositionDone, (int)filenames.size(),
+						filenames[worker.replayIndices[r]].str());
+					numErrors++;
+					writeReplayResult(resultsFile, filenames[worker.replayIndices[r]], 1, -1, -1, -1, 0, -1);
+				}
+				fflush(stdout);
+				continue;
+			}
+
+			workers.push_back(worker);
 		}
 
-		if (processes.empty())
+		if (workers.empty())
 			break;
 
 		// Don't waste CPU here, our workers need every bit of CPU time they can get
-		Sleep(100);
+		waitProcesses.clear();
+		size_t i;
+		for (i = 0; i < workers.size(); ++i)
+			waitProcesses.push_back(workers[i].process);
+		WorkerProcess::waitForAny(waitProcesses, 1000);
+
+		i = 0;
+		while (i < workers.size())
+		{
+			ReplayWorker &worker = workers[i];
+			worker.process.update();
+
+			const AsciiString stdOutput = worker.process.getStdOutput();
+			const char *output = stdOutput.str();
+			const size_t outputLength = stdOutput.getLength();
+
+			// Report every replay whose result line arrived since the last update
+			while (worker.outputParsed < outputLength)
+			{
+				const char *lineEnd = strchr(output + worker.outputParsed, '\n');
+				if (lineEnd == nullptr)
+					break;
+
+				const char *line = output + worker.outputParsed;
+				worker.outputParsed = (lineEnd - output) + 1;
+
+				Int frames, mismatchFrame, scheduleMismatches;
+				DWORD wallTimeMillis;
+				if (worker.numResults >= worker.replayIndices.size() ||
+					!parseReplayResult(line, frames, mismatchFrame, scheduleMismatches, wallTimeMillis))
+					continue;
+
+				const Bool failed = frames < 0 || mismatchFrame >= 0 || scheduleMismatches > 0;
+				filenamePositionDone++;
+				printf("%d/%d %.*s", (int)filenamePositionDone, (int)filenames.size(),
+					(int)(worker.outputParsed - worker.outputPrinted), output + worker.outputPrinted);
+				if (failed)
+					printf("Error!\n");
+				fflush(stdout);
+				if (failed)
+				{
+					worker.numFailed++;
+					numErrors++;
+				}
+				worker.outputPrinted = worker.outputParsed;
+
+				writeReplayResult(resultsFile, filenames[worker.replayIndices[worker.numResults]], failed ? 1 : 0, frames, mismatchFrame,
+					scheduleMismatches, wallTimeMillis, (Int64)worker.process.getPeakMemoryUsed());
+				worker.numResults++;
+			}
+
+			if (!worker.process.isDone())
+			{
+				++i;
+				continue;
+			}
+
+			// Print what is left of the output, and fail all replays the worker did not get to
+			DWORD exitcode = worker.process.getExitCode();
+			if (worker.numResults == worker.replayIndices.size())
+			{
+				printf("%s", output + worker.outputPrinted);
+				// The worker exits with an error code when a replay failed, that one is already counted
+				if (exitcode != 0 && worker.numFailed == 0)
+				{
+					printf("Error!\n");
+					numErrors++;
+				}
+			}
+			// A worker that is not headless prints no result lines, its exit code covers all its replays
+			const Bool printsResults = worker.numResults != 0 || TheGlobalData->m_headless;
+			for (; worker.numResults < worker.replayIndices.size(); ++worker.numResults)
+			{
+				const Bool failed = printsResults || exitcode != 0;
+				filenamePositionDone++;
+				printf("%d/%d %s", (int)filenamePositionDone, (int)filenames.size(), output + worker.outputPrinted);
+				if (failed)
+				{
+					printf("Error!\n");
+					numErrors++;
+				}
+				worker.outputPrinted = outputLength;
+
+				writeReplayResult(resultsFile, filenames[worker.replayIndices[worker.numResults]], failed && exitcode == 0 ? 1 : exitcode, -1, -1, -1,
+					worker.process.getWallTimeMillis(), (Int64)worker.process.getPeakMemoryUsed());
+			}
+			fflush(stdout);
+
+			workers.erase(workers.begin() + i);
+		}
 	}
 
 	DEBUG_ASSERTCRASH(filenamePositionStarted == filenames.size(), ("inconsistent file position 1"));
 	DEBUG_ASSERTCRASH(filenamePositionDone == filenames.size(), ("inconsistent file position 2"));
 
+	if (resultsFile != nullptr)
+		fclose(resultsFile);
+
 	printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
 
 	UnsignedInt realTime = (GetTickCount()-totalStartTimeMillis) / 1000;
@@ -119,7 +119,20 @@ void ArchiveFile::addFile(const AsciiString& path, const ArchivedFileInfo *fileI
 		tokenizer.nextToken(&token, "\\/");
 	}
 
-	dirInfo->m_files[fileInfo->m_filename] = *fileInfo;
+	ArchivedFileInfo &storedInfo = dirInfo->m_files[fileInfo->m_filename];
+	storedInfo = *fileInfo;
+
+	// Files without a dot can never be looked up by name, see ArchiveFileSystem::makeArchivedFileKey
+	if (fileInfo->m_filename.find('.') != nullptr)
+	{
+		AsciiString fullPath = path;
+		fullPath.concat('\\');
+		fullPath.concat(fileInfo->m_filename);
+
+		AsciiString key;
+		ArchiveFileSystem::makeArchivedFileKey(fullPath.str(), key);
+		m_fileInfoIndex[key] = &storedInfo;
+	}
 }
 
 void ArchiveFile::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
@@ -194,36 +207,16 @@ void ArchiveFile::attachFile(File *file)
 
 const ArchivedFileInfo * ArchiveFile::getArchivedFileInfo(const AsciiString& filename) const
 {
-	const DetailedArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
-
-	AsciiString token;
-	AsciiString tokenizer = filename;
-	tokenizer.toLower();
-	tokenizer.nextToken(&token, "\\/");
+	AsciiString key;
+	ArchiveFileSystem::makeArchivedFileKey(filename.str(), key);
 
-	while (!token.find('.') || tokenizer.find('.'))
+	ArchivedFileInfoIndex::const_iterator it = m_fileInfoIndex.find(key);
+	if (it != m_fileInfoIndex.end())
 	{
-		DetailedArchivedDirectoryInfoMap::const_iterator it = dirInfo->m_directories.find(token);
-		if (it != dirInfo->m_directories.end())
-		{
-			dirInfo = &it->second;
-		}
-		else
-		{
-			return nullptr;
-		}
-
-		tokenizer.nextToken(&token, "\\/");
-	}
-
-	ArchivedFileInfoMap::const_iterator it = dirInfo->m_files.find(token);
-	if (it != dirInfo->m_files.end())
-	{
-		return &it->second;
+		return it->second;
 	}
 	else
 	{
 		return nullptr;
 	}
-
 }
@@ -81,6 +81,8 @@
 
 ArchiveFileSystem *TheArchiveFileSystem = nullptr;
 
+DECLARE_PERF_TIMER(ArchiveFileLookup)
+
 
 //----------------------------------------------------------------------------
 //         Private Prototypes
@@ -166,7 +168,27 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 			fileIt = dirInfo->m_files.end();
 		}
 
-		dirInfo->m_files.insert(fileIt, std::make_pair(token, archiveFile));
+		ArchivedFileLocationMap::iterator insertedIt = dirInfo->m_files.insert(fileIt, std::make_pair(token, archiveFile));
+
+		// path and token are already in the form makeArchivedFileKey produces
+		AsciiString key = path;
+		key.concat(token);
+
+		ArchivedFileIndex::iterator indexIt = m_fileIndex.find(key);
+		if (indexIt == m_fileIndex.end())
+		{
+			ArchivedFileLocations locations;
+			locations.first = insertedIt;
+			locations.count = 1;
+			m_fileIndex[key] = locations;
+		}
+		else
+		{
+			// An overwriting file was inserted in front of the others, otherwise it went to the back
+			if (overwrite)
+				indexIt->second.first = insertedIt;
+			++indexIt->second.count;
+		}
 
 #if defined(DEBUG_LOGGING) && ENABLE_FILESYSTEM_LOGGING
 		{
@@ -240,14 +262,7 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
-
-	if (!result.valid())
-		return false;
-
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	return range.valid();
+	return getArchiveFile(filename, instance) != nullptr;
 }
 
 ArchivedDirectoryInfo* ArchiveFileSystem::friend_getArchivedDirectoryInfo(const Char* directory)
@@ -319,17 +334,67 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
+	USE_PERF_TIMER(ArchiveFileLookup)
 
-	if (!result.valid())
-		return nullptr;
+	AsciiString key;
+	makeArchivedFileKey(filename.str(), key);
 
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
+	ArchivedFileIndex::const_iterator indexIt = m_fileIndex.find(key);
+	if (indexIt == m_fileIndex.end())
+		return nullptr;
 
-	if (!range.valid())
+	const ArchivedFileLocations& locations = indexIt->second;
+	if (instance >= locations.count)
 		return nullptr;
-	
-	return range.get()->second;
+
+	ArchivedFileLocationMap::iterator it = locations.first;
+	std::advance(it, instance);
+	return it->second;
+}
+
+void ArchiveFileSystem::makeArchivedFileKey(const Char* filename, AsciiString& key)
+{
+	// The file name is the token that holds the last dot, anything after it is ignored. Without
+	// any dot all tokens are directories and the file name is empty.
+	const Char* lastDot = strrchr(filename, '.');
+
+	Int length = 0;
+	Char buffer[_MAX_PATH];
+	const Char* c = filename;
+
+	while (*c != 0)
+	{
+		// skip separators
+		while (*c == '\\' || *c == '/')
+			++c;
+
+		if (*c == 0)
+			break;
+
+		const Char* tokenStart = c;
+		while (*c != 0 && *c != '\\' && *c != '/')
+			++c;
+
+		const Int tokenLength = (Int)(c - tokenStart);
+		const Bool isFileName = lastDot != nullptr && lastDot >= tokenStart && lastDot < c;
+
+		if (length + tokenLength + 1 >= _MAX_PATH)
+		{
+			// never happens for valid paths, just don't overrun the buffer
+			break;
+		}
+
+		for (Int i = 0; i < tokenLength; ++i)
+			buffer[length++] = (Char)tolower((unsigned char)tokenStart[i]);
+
+		if (isFileName)
+			break;
+
+		buffer[length++] = '\\';
+	}
+
+	buffer[length] = 0;
+	key.set(buffer, length);
 }
 
 void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
@@ -195,6 +195,75 @@ DECLARE_PERF_TIMER(MemoryPoolInitFilling)
 static Bool thePreMainInitFlag = false;
 static Bool theMainInitFlag = false;
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+
+#ifdef _MSC_VER
+	#define MEMORYPOOL_THREAD_LOCAL __declspec(thread)
+#else
+	#define MEMORYPOOL_THREAD_LOCAL __thread
+#endif
+
+enum
+{
+	MAX_THREAD_CACHED_POOLS = 1024,		///< pools created after this many do not get a thread cache
+	THREAD_CACHE_SIZE = 8,						///< max number of free blocks a thread keeps per pool
+	THREAD_CACHE_BATCH = THREAD_CACHE_SIZE / 2	///< number of blocks moved from or to the pool at once
+};
+
+/**
+	The free blocks of one pool that one thread keeps for itself. Blocks in here count as used
+	for the pool, so nothing else can hand them out, and they are only ever touched by their
+	owning thread, so no lock is needed to push or pop them. With MEMORYPOOL_DEBUG the blocks
+	are marked free while they sit in here, so leak and checkpoint reports do not list them.
+*/
+struct MemoryPoolThreadCacheSlot
+{
+	Int generation;		///< generation of the owning pool when the blocks were cached
+	Int count;
+	void *blocks[THREAD_CACHE_SIZE];
+};
+
+/**
+	The cache slots of one thread, indexed by MemoryPool::m_threadCacheSlot. Allocated on the first
+	pooled allocation of a thread and linked into theThreadCacheList, so that a pool that is
+	destroyed can take its blocks back from every thread, and freed again when the thread exits.
+*/
+struct MemoryPoolThreadCache
+{
+	MemoryPoolThreadCache *next;
+	MemoryPoolThreadCache *prev;
+	MemoryPoolThreadCacheSlot slots[MAX_THREAD_CACHED_POOLS];
+};
+
+static MEMORYPOOL_THREAD_LOCAL MemoryPoolThreadCache *theThreadCache = nullptr;
+static MemoryPoolThreadCache *theThreadCacheList = nullptr;					///< all thread caches. guarded by TheMemoryPoolCriticalSection
+static MemoryPool *theThreadCachedPools[MAX_THREAD_CACHED_POOLS];		///< the pool of each slot, or null once it is destroyed. guarded by TheMemoryPoolCriticalSection
+static LONG theNumThreadCachedPools = 0;
+
+// Fiber local storage is used only for its destructor callback, which runs when a thread exits.
+// It is looked up at runtime, as it does not exist before Windows Vista; there the caches of
+// exited threads are not freed.
+typedef VOID (WINAPI *ThreadCacheExitCallback)(PVOID);
+typedef DWORD (WINAPI *ThreadCacheFlsAlloc)(ThreadCacheExitCallback);
+typedef BOOL (WINAPI *ThreadCacheFlsSetValue)(DWORD, PVOID);
+static ThreadCacheFlsSetValue theFlsSetValue = nullptr;
+static DWORD theThreadCacheFlsIndex = 0;
+static Bool theThreadCacheFlsInited = false;
+
+static void registerThreadCache(MemoryPoolThreadCache *cache);
+static void releaseThreadCache(MemoryPoolThreadCache *cache);
+
+#define MEMORYPOOL_INTERLOCKED_INCREMENT(i) ::InterlockedIncrement((LONG *)&(i))
+#define MEMORYPOOL_INTERLOCKED_DECREMENT(i) ::InterlockedDecrement((LONG *)&(i))
+
+// the subpools of a dma lock for themselves, so the dma only has to lock its raw block list.
+// the debug bookkeeping of the dma is not thread safe, so with MEMORYPOOL_DEBUG it keeps its lock.
+#ifndef MEMORYPOOL_DEBUG
+	#define DMA_LOCKS_RAW_BLOCKS_ONLY
+#endif
+
+#endif // MEMORYPOOL_THREAD_CACHE
+
 // ----------------------------------------------------------------------------
 // PRIVATE PROTOTYPES
 // ----------------------------------------------------------------------------
@@ -1505,9 +1574,18 @@ MemoryPool::MemoryPool() :
 	m_usedBlocksInPool(0),
 	m_totalBlocksInPool(0),
 	m_peakUsedBlocksInPool(0),
+	m_allocationCount(0),
+	m_freeCount(0),
+	m_overflowBlobCount(0),
+	m_reportedAllocationCount(0),
+	m_reportedFreeCount(0),
 	m_firstBlob(nullptr),
 	m_lastBlob(nullptr),
 	m_firstBlobWithFreeBlocks(nullptr)
+#ifdef MEMORYPOOL_THREAD_CACHE
+	, m_threadCacheSlot(-1)
+	, m_threadCacheGeneration(0)
+#endif
 {
 }
 
@@ -1530,6 +1608,21 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 	m_lastBlob = nullptr;
 	m_firstBlobWithFreeBlocks = nullptr;
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	// pools that may not grow are not cached, as blocks sitting in the cache of one
+	// thread would make allocations on other threads fail.
+	if (m_threadCacheSlot < 0 && m_overflowAllocationCount > 0)
+	{
+		const Int slot = MEMORYPOOL_INTERLOCKED_INCREMENT(theNumThreadCachedPools) - 1;
+		if (slot < MAX_THREAD_CACHED_POOLS)
+		{
+			ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+			m_threadCacheSlot = slot;
+			theThreadCachedPools[slot] = this;
+		}
+	}
+#endif
+
 	// go ahead and init the initial block here (will throw on failure)
 	createBlob(m_initialAllocationCount);
 }
@@ -1628,8 +1721,54 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 */
 void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
 {
+	// TheSuperHackers @performance Always counted for the pool telemetry. Not locked, so the counts
+	// are only exact for pools that are used by one thread at a time, which is the common case.
+	++m_allocationCount;
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MemoryPoolThreadCacheSlot *slot = getThreadCacheSlot();
+	if (slot != nullptr)
+	{
+		if (slot->count == 0)
+		{
+			// take a few blocks at once, so that a thread that keeps allocating takes the lock less often
+			ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+			while (slot->count < THREAD_CACHE_BATCH)
+			{
+				void *pCachedPtr = allocateBlockFromBlobs(PASS_LITERALSTRING_ARG1);	// throws on failure
+			#ifdef MEMORYPOOL_DEBUG
+				debugBlockFreed(MemoryPoolSingleBlock::recoverBlockFromUserData(pCachedPtr));
+			#endif
+				slot->blocks[slot->count] = pCachedPtr;
+				++slot->count;
+			}
+		}
+		void *pBlockPtr = slot->blocks[--slot->count];
+	#ifdef MEMORYPOOL_DEBUG
+		{
+			ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+			MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+			block->initBlock(getAllocationSize(), block->getOwningBlob(), m_factory PASS_LITERALSTRING_ARG2);
+			debugBlockAllocated(block PASS_LITERALSTRING_ARG2);
+		}
+	#endif
+		return pBlockPtr;
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+	return allocateBlockFromBlobs(PASS_LITERALSTRING_ARG1);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	allocate a block from the blobs of this pool. the caller must hold
+	TheMemoryPoolCriticalSection. if unable to allocate, throw ERROR_OUT_OF_MEMORY.
+	this function will never return null.
+*/
+void* MemoryPool::allocateBlockFromBlobs(DECLARE_LITERALSTRING_ARG1)
+{
 	if (m_firstBlobWithFreeBlocks != nullptr && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks())
 	{
 		// hmm... the current 'free' blob has nothing available. look and see if there
@@ -1657,6 +1796,7 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 		else
 		{
 			createBlob(m_overflowAllocationCount); // throws on failure
+			++m_overflowBlobCount;
 		}
 	}
 
@@ -1667,18 +1807,32 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	MemoryPoolSingleBlock *block = blob->allocateSingleBlock(PASS_LITERALSTRING_ARG1);
 	DEBUG_ASSERTCRASH(block, ("should not fail here"));
 
-#ifdef MEMORYPOOL_CHECKPOINTING
-	BlockCheckpointInfo *bi = debugAddCheckpointInfo(block->debugGetLiteralTagString(), m_factory->getCurCheckpoint(), getAllocationSize());
-	if (bi)
-		block->debugSetCheckpointInfo(bi);
-#endif
-
 	// bookkeeping
 	++m_usedBlocksInPool;
 	if (m_peakUsedBlocksInPool < m_usedBlocksInPool)
 		m_peakUsedBlocksInPool = m_usedBlocksInPool;
 
 #ifdef MEMORYPOOL_DEBUG
+	debugBlockAllocated(block PASS_LITERALSTRING_ARG2);
+#endif
+
+	return block->getUserData();
+}
+
+#ifdef MEMORYPOOL_DEBUG
+//-----------------------------------------------------------------------------
+/**
+	do the debug bookkeeping for a block that is handed out. the caller must hold
+	TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::debugBlockAllocated(MemoryPoolSingleBlock *block DECLARE_LITERALSTRING_ARG2)
+{
+#ifdef MEMORYPOOL_CHECKPOINTING
+	BlockCheckpointInfo *bi = debugAddCheckpointInfo(block->debugGetLiteralTagString(), m_factory->getCurCheckpoint(), getAllocationSize());
+	if (bi)
+		block->debugSetCheckpointInfo(bi);
+#endif
+
 	m_factory->adjustTotals(debugLiteralTagString, 1*getAllocationSize(), 0);
 	#ifdef USE_FILLER_VALUE
 	{
@@ -1686,10 +1840,26 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 		::memset32(block->getUserData(), s_initFillerValue, getAllocationSize());
 	}
 	#endif
+}
+
+//-----------------------------------------------------------------------------
+/**
+	do the debug bookkeeping for a block that is given back, and mark it as free. the
+	caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::debugBlockFreed(MemoryPoolSingleBlock *block)
+{
+#ifdef MEMORYPOOL_CHECKPOINTING
+	BlockCheckpointInfo *bi = block->debugGetCheckpointInfo();
+	DEBUG_ASSERTCRASH(bi, ("hmm, no checkpoint info"));
+	if (bi)
+		bi->debugSetFreepoint(m_factory->getCurCheckpoint());
 #endif
 
-	return block->getUserData();
+	m_factory->adjustTotals(block->debugGetLiteralTagString(), -1*getAllocationSize(), 0);
+	block->debugMarkBlockAsFree();
 }
+#endif // MEMORYPOOL_DEBUG
 
 //-----------------------------------------------------------------------------
 /**
@@ -1713,22 +1883,64 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
+	++m_freeCount;
+
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MemoryPoolThreadCacheSlot *slot = getThreadCacheSlot();
+	if (slot != nullptr)
+	{
+		DEBUG_ASSERTCRASH(MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr)->getOwningBlob()->getOwningPool() == this, ("block does not belong to this pool"));
+		if (slot->count == THREAD_CACHE_SIZE)
+		{
+			// give back a few blocks at once, but keep some for the next allocations
+			ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+			while (slot->count > THREAD_CACHE_SIZE - THREAD_CACHE_BATCH)
+			{
+				--slot->count;
+				returnBlockToBlob(MemoryPoolSingleBlock::recoverBlockFromUserData(slot->blocks[slot->count]));
+			}
+		}
+	#ifdef MEMORYPOOL_DEBUG
+		{
+			ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+			debugBlockFreed(MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr));
+		}
+	#endif
+		slot->blocks[slot->count++] = pBlockPtr;
+		return;
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+	freeBlockToBlob(pBlockPtr);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	free a block back to its blob. the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::freeBlockToBlob(void* pBlockPtr)
+{
 	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
-	MemoryPoolBlob *blob = block->getOwningBlob();
+
 #ifdef MEMORYPOOL_DEBUG
-	const char* tagString = block->debugGetLiteralTagString();
+	debugBlockFreed(block);
 #endif
 
-	DEBUG_ASSERTCRASH(blob && blob->getOwningPool() == this, ("block does not belong to this pool"));
+	returnBlockToBlob(block);
+}
 
-#ifdef MEMORYPOOL_CHECKPOINTING
-	BlockCheckpointInfo *bi = block->debugGetCheckpointInfo();
-	DEBUG_ASSERTCRASH(bi, ("hmm, no checkpoint info"));
-	if (bi)
-		bi->debugSetFreepoint(m_factory->getCurCheckpoint());
-#endif
+//-----------------------------------------------------------------------------
+/**
+	put a block back on the free list of its blob, without the debug bookkeeping. the caller
+	must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::returnBlockToBlob(MemoryPoolSingleBlock *block)
+{
+	MemoryPoolBlob *blob = block->getOwningBlob();
+
+	DEBUG_ASSERTCRASH(blob && blob->getOwningPool() == this, ("block does not belong to this pool"));
 
 	blob->freeSingleBlock(block);
 
@@ -1746,10 +1958,206 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 
 	// bookkeeping
 	--m_usedBlocksInPool;
+}
 
-#ifdef MEMORYPOOL_DEBUG
-	m_factory->adjustTotals(tagString, -1*getAllocationSize(), 0);
-#endif
+#ifdef MEMORYPOOL_THREAD_CACHE
+//-----------------------------------------------------------------------------
+/**
+	return the cache slot of this pool for the calling thread, or null if this pool
+	has no thread cache. drops the cached blocks if the pool was reset since they were cached.
+*/
+MemoryPoolThreadCacheSlot *MemoryPool::getThreadCacheSlot()
+{
+	if (m_threadCacheSlot < 0)
+		return nullptr;
+
+	if (theThreadCache == nullptr)
+	{
+		theThreadCache = (MemoryPoolThreadCache *)::sysAllocateDoNotZero(sizeof(MemoryPoolThreadCache));	// throws on failure
+		memset(theThreadCache, 0, sizeof(MemoryPoolThreadCache));
+		registerThreadCache(theThreadCache);
+	}
+
+	MemoryPoolThreadCacheSlot *slot = &theThreadCache->slots[m_threadCacheSlot];
+	if (slot->generation != m_threadCacheGeneration)
+	{
+		// the blobs these blocks came from are gone.
+		slot->generation = m_threadCacheGeneration;
+		slot->count = 0;
+	}
+	return slot;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the blocks in the given cache slot of this pool back to their blobs. the thread
+	that owns the slot must not be using this pool. the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::flushThreadCacheSlot(MemoryPoolThreadCacheSlot *slot)
+{
+	if (slot->generation != m_threadCacheGeneration)
+	{
+		// the blobs these blocks came from are gone.
+		slot->generation = m_threadCacheGeneration;
+		slot->count = 0;
+		return;
+	}
+
+	while (slot->count > 0)
+	{
+		--slot->count;
+		returnBlockToBlob(MemoryPoolSingleBlock::recoverBlockFromUserData(slot->blocks[slot->count]));
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the blocks the calling thread has cached for this pool back to their blobs.
+	the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::flushThreadCache()
+{
+	if (m_threadCacheSlot < 0 || theThreadCache == nullptr)
+		return;
+
+	flushThreadCacheSlot(&theThreadCache->slots[m_threadCacheSlot]);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the blocks every thread has cached for this pool back to their blobs, and stop
+	caching this pool. only for a pool that is about to be destroyed: no other thread may
+	be using it anymore, so their slots for it are not touched concurrently.
+	the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::removeFromThreadCaches()
+{
+	if (m_threadCacheSlot < 0)
+		return;
+
+	for (MemoryPoolThreadCache *cache = theThreadCacheList; cache; cache = cache->next)
+	{
+		flushThreadCacheSlot(&cache->slots[m_threadCacheSlot]);
+	}
+
+	theThreadCachedPools[m_threadCacheSlot] = nullptr;
+	m_threadCacheSlot = -1;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	called by the fiber local storage when a thread exits. gives the blocks of the
+	thread back to their pools and frees its cache.
+*/
+static VOID WINAPI threadCacheExitCallback(PVOID data)
+{
+	MemoryPoolThreadCache *cache = (MemoryPoolThreadCache *)data;
+	if (cache == nullptr)
+		return;
+
+	if (theThreadCache == cache)
+		theThreadCache = nullptr;
+
+	releaseThreadCache(cache);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	link a new thread cache into theThreadCacheList, and have it released when its thread exits.
+*/
+static void registerThreadCache(MemoryPoolThreadCache *cache)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	cache->prev = nullptr;
+	cache->next = theThreadCacheList;
+	if (theThreadCacheList)
+		theThreadCacheList->prev = cache;
+	theThreadCacheList = cache;
+
+	if (!theThreadCacheFlsInited)
+	{
+		theThreadCacheFlsInited = true;
+
+		HMODULE kernel = ::GetModuleHandleA("kernel32.dll");
+		if (kernel)
+		{
+			ThreadCacheFlsAlloc flsAlloc = (ThreadCacheFlsAlloc)::GetProcAddress(kernel, "FlsAlloc");
+			ThreadCacheFlsSetValue flsSetValue = (ThreadCacheFlsSetValue)::GetProcAddress(kernel, "FlsSetValue");
+			if (flsAlloc && flsSetValue)
+			{
+				theThreadCacheFlsIndex = flsAlloc(threadCacheExitCallback);
+				if (theThreadCacheFlsIndex != TLS_OUT_OF_INDEXES)	// same value as FLS_OUT_OF_INDEXES
+					theFlsSetValue = flsSetValue;
+			}
+		}
+	}
+
+	if (theFlsSetValue)
+		theFlsSetValue(theThreadCacheFlsIndex, cache);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the blocks in a thread cache back to the pools that still exist, unlink it from
+	theThreadCacheList and free it. its thread must not use it anymore.
+*/
+static void releaseThreadCache(MemoryPoolThreadCache *cache)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	const Int numSlots = min((Int)theNumThreadCachedPools, (Int)MAX_THREAD_CACHED_POOLS);
+	for (Int i = 0; i < numSlots; ++i)
+	{
+		if (theThreadCachedPools[i] != nullptr)
+			theThreadCachedPools[i]->flushThreadCacheSlot(&cache->slots[i]);
+	}
+
+	if (cache->prev)
+		cache->prev->next = cache->next;
+	else
+		theThreadCacheList = cache->next;
+	if (cache->next)
+		cache->next->prev = cache->prev;
+
+	::sysFree((void *)cache);
+}
+#endif // MEMORYPOOL_THREAD_CACHE
+
+//-----------------------------------------------------------------------------
+/**
+	write one CSV line for this pool if it allocated or freed blocks since the previous call.
+	allocs and frees are counted since the previous call, overflowBlobs since pool creation.
+*/
+void MemoryPool::telemetryReport(FILE *fp, const char *label, UnsignedInt frame)
+{
+	const UnsignedInt allocs = m_allocationCount - m_reportedAllocationCount;
+	const UnsignedInt frees = m_freeCount - m_reportedFreeCount;
+	if (allocs == 0 && frees == 0)
+		return;
+
+	m_reportedAllocationCount += allocs;
+	m_reportedFreeCount += frees;
+
+	fputc('"', fp);
+	for (const char *c = label ? label : ""; *c; ++c)
+	{
+		if (*c == '"')
+			fputc('"', fp);
+		fputc(*c, fp);
+	}
+	fprintf(fp, "\",%u,%s,%d,%d,%d,%d,%d,%d,%u,%u,%d\n",
+		frame,
+		m_poolName,
+		m_allocationSize,
+		m_initialAllocationCount,
+		m_overflowAllocationCount,
+		m_usedBlocksInPool,
+		m_totalBlocksInPool,
+		m_peakUsedBlocksInPool,
+		allocs,
+		frees,
+		m_overflowBlobCount);
 }
 
 //-----------------------------------------------------------------------------
@@ -1774,6 +2182,10 @@ Int MemoryPool::releaseEmpties()
 {
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	flushThreadCache();
+#endif
+
 	Int released = 0;
 
 	for (MemoryPoolBlob* blob = m_firstBlob; blob;)
@@ -1805,6 +2217,11 @@ void MemoryPool::reset()
 	m_lastBlob = nullptr;
 	m_firstBlobWithFreeBlocks = nullptr;
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	// blocks cached by any thread went away with the blobs
+	++m_threadCacheGeneration;
+#endif
+
 	init(m_factory, m_poolName, m_allocationSize, m_initialAllocationCount, m_overflowAllocationCount);	// will throw on failure
 
 }
@@ -2010,6 +2427,7 @@ DynamicMemoryAllocator::DynamicMemoryAllocator() :
 {
 	for (Int i = 0; i < MAX_DYNAMICMEMORYALLOCATOR_SUBPOOLS; i++)
 		m_pools[i] = nullptr;
+	memset(m_poolForSizeClass, 0, sizeof(m_poolForSizeClass));
 }
 
 //-----------------------------------------------------------------------------
@@ -2047,6 +2465,22 @@ void DynamicMemoryAllocator::init(MemoryPoolFactory *factory, Int numSubPools, c
 		DEBUG_ASSERTCRASH(i == 0 || pParms[i].allocationSize > pParms[i-1].allocationSize, ("alloc size must increase monotonically for DMA"));
 		m_pools[i] = m_factory->createMemoryPool(&pParms[i]);
 	}
+
+	// TheSuperHackers @performance Precompute the best subpool for every small size,
+	// so that findPoolForSize does not need to scan the subpools.
+	for (Int sizeClass = 0; sizeClass < MAX_DYNAMICMEMORYALLOCATOR_SIZECLASSES; sizeClass++)
+	{
+		const Int allocSize = sizeClass * DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES;
+		m_poolForSizeClass[sizeClass] = 0;
+		for (Int i = 0; i < m_numPools; i++)
+		{
+			if (allocSize <= m_pools[i]->getAllocationSize())
+			{
+				m_poolForSizeClass[sizeClass] = (UnsignedByte)(i + 1);
+				break;
+			}
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -2077,6 +2511,15 @@ DynamicMemoryAllocator::~DynamicMemoryAllocator()
 */
 MemoryPool *DynamicMemoryAllocator::findPoolForSize(Int allocSize)
 {
+	// pool sizes are multiples of DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES, so rounding up
+	// the requested size to its size class does not change which pool fits.
+	const Int sizeClass = (allocSize + DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES - 1) / DYNAMICMEMORYALLOCATOR_SIZECLASS_BYTES;
+	if (allocSize >= 0 && sizeClass < MAX_DYNAMICMEMORYALLOCATOR_SIZECLASSES)
+	{
+		const Int index = m_poolForSizeClass[sizeClass];
+		return index ? m_pools[index - 1] : nullptr;
+	}
+
 	for (Int i = 0; i < m_numPools; i++)
 	{
 		DEBUG_ASSERTCRASH(m_pools[i], ("null pool"));
@@ -2161,7 +2604,9 @@ void DynamicMemoryAllocator::debugIgnoreLeaksForThisBlock(void* pBlockPtr)
 */
 void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes DECLARE_LITERALSTRING_ARG2)
 {
+#ifndef DMA_LOCKS_RAW_BLOCKS_ONLY
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 
 	void *result = nullptr;
 
@@ -2194,6 +2639,9 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 	else
 	{
 		// too big for our pools -- just go right to the metal.
+#ifdef DMA_LOCKS_RAW_BLOCKS_ONLY
+		ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 		MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::rawAllocateSingleBlock(&m_rawBlocks, numBytes, m_factory PASS_LITERALSTRING_ARG2);
 
 #ifdef MEMORYPOOL_CHECKPOINTING
@@ -2235,7 +2683,11 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 }
 #endif // MEMORYPOOL_DEBUG
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MEMORYPOOL_INTERLOCKED_INCREMENT(m_usedBlocksInDma);
+#else
 	++m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 #ifdef MEMORYPOOL_DEBUG
 	#ifdef USE_FILLER_VALUE
@@ -2277,7 +2729,9 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;
 
+#ifndef DMA_LOCKS_RAW_BLOCKS_ONLY
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 
 #ifdef MEMORYPOOL_CHECK_BLOCK_OWNERSHIP
 	DEBUG_ASSERTCRASH(debugIsBlockInDma(pBlockPtr), ("block is not in this dma"));
@@ -2324,6 +2778,9 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	else
 	{
 		// was allocated via sysAllocate.
+#ifdef DMA_LOCKS_RAW_BLOCKS_ONLY
+		ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 #ifdef MEMORYPOOL_CHECKPOINTING
 		BlockCheckpointInfo *bi = block->debugGetCheckpointInfo();
 		DEBUG_ASSERTCRASH(bi, ("hmm, no checkpoint info"));
@@ -2344,7 +2801,11 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 		::sysFree((void *)block);
 
 	}
+#ifdef MEMORYPOOL_THREAD_CACHE
+	MEMORYPOOL_INTERLOCKED_DECREMENT(m_usedBlocksInDma);
+#else
 	--m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 
 #ifdef INTENSE_DMA_BOOKKEEPING
@@ -2699,6 +3160,13 @@ void MemoryPoolFactory::destroyMemoryPool(MemoryPool *pMemoryPool)
 	if (!pMemoryPool)
 		return;
 
+#ifdef MEMORYPOOL_THREAD_CACHE
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		pMemoryPool->removeFromThreadCaches();
+	}
+#endif
+
 	DEBUG_ASSERTCRASH(pMemoryPool->getUsedBlockCount() == 0, ("destroying a nonempty pool"));
 
 	pMemoryPool->removeFromList(&m_firstPoolInFactory);
@@ -2963,6 +3431,30 @@ void MemoryPoolFactory::debugResetCheckpoints()
 }
 #endif
 
+//-----------------------------------------------------------------------------
+/**
+	TheSuperHackers @performance Append one CSV line per pool that allocated or freed blocks
+	since the previous report. Unlike memoryPoolUsageReport this works in all builds, so real
+	game data can be used to size the initial pool counts. A header is written into empty files.
+*/
+void MemoryPoolFactory::memoryPoolTelemetryReport( FILE *fp, const char *label, UnsignedInt frame )
+{
+	if (fp == nullptr)
+		return;
+
+	if (ftell(fp) == 0)
+	{
+		fprintf(fp, "label,frame,pool,blockSize,initialBlocks,overflowBlocks,usedBlocks,totalBlocks,peakBlocks,allocs,frees,overflowBlobs\n");
+	}
+
+	for (MemoryPool *pool = m_firstPoolInFactory; pool; pool = pool->getNextPoolInList())
+	{
+		pool->telemetryReport(fp, label, frame);
+	}
+
+	fflush(fp);
+}
+
 //-----------------------------------------------------------------------------
 void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead )
 {
@@ -89,6 +89,10 @@ void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appen
 {
 }
 
+void MemoryPoolFactory::memoryPoolTelemetryReport( FILE *fp, const char *label, UnsignedInt frame )
+{
+}
+
 #ifdef MEMORYPOOL_DEBUG
 void MemoryPoolFactory::debugMemoryReport(Int flags, Int startCheckpoint, Int endCheckpoint, FILE *fp )
 {
@@ -104,7 +104,8 @@
 RAMFile::RAMFile()
 : m_size(0),
 	m_data(nullptr),
-	m_pos(0)
+	m_pos(0),
+	m_ownsData(TRUE)
 {
 
 }
@@ -177,6 +178,7 @@ Bool RAMFile::open( File *file )
 	// read whole file in to memory
 	m_size = file->size();
 	m_data = MSGNEW("RAMFILE") char [ m_size ];	// pool[]ify
+	m_ownsData = TRUE;
 
 	if ( m_data == nullptr )
 	{
@@ -211,8 +213,9 @@ Bool RAMFile::openFromArchive(File *archiveFile, const AsciiString& filename, In
 		return FALSE;
 	}
 
-	delete[] m_data;
+	closeFile();
 	m_data = MSGNEW("RAMFILE") Char [size];	// pool[]ify
+	m_ownsData = TRUE;
 	m_size = size;
 
 	if (archiveFile->seek(offset, File::START) != offset) {
@@ -226,6 +229,36 @@ Bool RAMFile::openFromArchive(File *archiveFile, const AsciiString& filename, In
 	return TRUE;
 }
 
+//============================================================================
+// RAMFile::openView
+//============================================================================
+/**
+	* TheSuperHackers @performance Open the file as a read only view of the
+	* given memory, for example a memory mapped archive, instead of copying it.
+	* The memory must stay valid until the file is closed.
+	*/
+//============================================================================
+Bool RAMFile::openView(const AsciiString& filename, const Char *data, Int size)
+{
+	if (data == nullptr && size != 0) {
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		return FALSE;
+	}
+
+	closeFile();
+	// RAMFile never writes through m_data, so the view stays read only
+	m_data = const_cast<Char *>(data);
+	m_ownsData = FALSE;
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
 //=================================================================
 // RAMFile::close
 //=================================================================
@@ -245,8 +278,10 @@ void RAMFile::close( void )
 
 void RAMFile::closeFile()
 {
-	delete [] m_data;
+	if (m_ownsData)
+		delete [] m_data;
 	m_data = nullptr;
+	m_ownsData = TRUE;
 }
 
 //=================================================================
@@ -556,6 +591,12 @@ char* RAMFile::readEntireAndClose()
 	}
 
 	char* tmp = m_data;
+	if (!m_ownsData)
+	{
+		// a view is not ours to give away, so hand out a copy
+		tmp = NEW char[m_size];
+		memcpy(tmp, m_data, m_size);
+	}
 	m_data = nullptr;	// will belong to our caller!
 
 	close();
@@ -36,6 +36,15 @@
 #include "Common/Snapshot.h"
 #include "Utility/endian_compat.h"
 
+//-------------------------------------------------------------------------------------------------
+/** One step of the logic CRC: rotate left by one and add. Every step depends on the previous one
+	* through the carries of the add, so the words cannot be summed in parallel lanes. */
+//-------------------------------------------------------------------------------------------------
+static inline UnsignedInt stepCRC( UnsignedInt crc, UnsignedInt val )
+{
+	return ((crc << 1) | (crc >> 31)) + val;
+}
+
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
 XferCRC::XferCRC( void )
@@ -43,6 +52,7 @@ XferCRC::XferCRC( void )
 
 	m_xferMode = XFER_CRC;
 	m_crc = 0;
+	m_stepRecording = nullptr;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -95,7 +105,7 @@ void XferCRC::endBlock( void )
 void XferCRC::addCRC( UnsignedInt val )
 {
 
-	m_crc = (m_crc << 1) + htobe(val) + ((m_crc >> 31) & 0x01);
+	m_crc = stepCRC( m_crc, htobe(val) );
 
 }
 
@@ -125,11 +135,28 @@ void XferCRC::xferImplementation( void *data, Int dataSize )
 	const UnsignedInt *uintPtr = (const UnsignedInt *) (data);
 	dataSize *= (data != nullptr);
 
-	int dataBytes = (dataSize / 4);
+	if (m_stepRecording != nullptr)
+	{
+		recordImplementation( data, dataSize );
+		return;
+	}
+
+	// TheSuperHackers @performance Accumulate in a local, so the CRC is not stored back to m_crc
+	// after every word in case the data aliases it, and unroll by four words.
+	UnsignedInt crc = m_crc;
+	Int dataWords = (dataSize / 4);
+
+	for (; dataWords >= 4; dataWords -= 4, uintPtr += 4)
+	{
+		crc = stepCRC( crc, htobe(uintPtr[0]) );
+		crc = stepCRC( crc, htobe(uintPtr[1]) );
+		crc = stepCRC( crc, htobe(uintPtr[2]) );
+		crc = stepCRC( crc, htobe(uintPtr[3]) );
+	}
 
-	for (Int i=0 ; i<dataBytes; ++i)
+	for (; dataWords > 0; --dataWords)
 	{
-		addCRC (*uintPtr++);
+		crc = stepCRC( crc, htobe(*uintPtr++) );
 	}
 
 	UnsignedInt val = 0;
@@ -145,12 +172,77 @@ void XferCRC::xferImplementation( void *data, Int dataSize )
 		FALLTHROUGH;
 	case 1:
 		val += c[0];
-		m_crc = (m_crc << 1) + val + ((m_crc >> 31) & 0x01);
+		crc = stepCRC( crc, val );
 		FALLTHROUGH;
 	default:
 		break;
 	}
 
+	m_crc = crc;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Same as xferImplementation, but also appends every CRC step to the step recording */
+//-------------------------------------------------------------------------------------------------
+void XferCRC::recordImplementation( const void *data, Int dataSize )
+{
+	const UnsignedInt *uintPtr = (const UnsignedInt *) (data);
+	UnsignedInt crc = m_crc;
+
+	for (Int dataWords = (dataSize / 4); dataWords > 0; --dataWords)
+	{
+		UnsignedInt val = htobe(*uintPtr++);
+		m_stepRecording->push_back( val );
+		crc = stepCRC( crc, val );
+	}
+
+	if (dataSize & 3)
+	{
+		UnsignedInt val = 0;
+		const unsigned char *c = (const unsigned char *)uintPtr;
+
+		switch(dataSize & 3)
+		{
+		case 3:
+			val += (c[2] << 16);
+			FALLTHROUGH;
+		case 2:
+			val += (c[1] << 8);
+			FALLTHROUGH;
+		default:
+			val += c[0];
+			break;
+		}
+
+		m_stepRecording->push_back( val );
+		crc = stepCRC( crc, val );
+	}
+
+	m_crc = crc;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Replay CRC steps that were recorded with setStepRecording. The result is identical to xfering
+	* the data that produced them again. */
+//-------------------------------------------------------------------------------------------------
+void XferCRC::addCRCSteps( const UnsignedInt *steps, Int count )
+{
+	UnsignedInt crc = m_crc;
+
+	for (Int i = 0; i < count; ++i)
+	{
+		crc = stepCRC( crc, steps[i] );
+	}
+
+	if (m_stepRecording != nullptr)
+	{
+		m_stepRecording->insert( m_stepRecording->end(), steps, steps + count );
+	}
+
+	m_crc = crc;
+
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -34,6 +34,10 @@
 #include "Common/Snapshot.h"
 #include "Common/XferLoad.h"
 
+// TheSuperHackers @performance The file is read in chunks of this size instead of one read per field.
+// A whole file is not read at once, because listing the save games only reads the first blocks.
+static const Int XFER_LOAD_BUFFER_SIZE = 64 * 1024;
+
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
 XferLoad::XferLoad( void )
@@ -41,6 +45,8 @@ XferLoad::XferLoad( void )
 
 	m_xferMode = XFER_LOAD;
 	m_fileFP = nullptr;
+	m_bufferPos = 0;
+	m_bufferEnd = 0;
 
 }
 
@@ -89,6 +95,10 @@ void XferLoad::open( AsciiString identifier )
 
 	}
 
+	m_buffer.resize( XFER_LOAD_BUFFER_SIZE );
+	m_bufferPos = 0;
+	m_bufferEnd = 0;
+
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -109,6 +119,8 @@ void XferLoad::close( void )
 	// close the file
 	fclose( m_fileFP );
 	m_fileFP = nullptr;
+	m_bufferPos = 0;
+	m_bufferEnd = 0;
 
 	// erase the filename
 	m_identifier.clear();
@@ -127,7 +139,7 @@ Int XferLoad::beginBlock( void )
 
 	// read block size
 	XferBlockSize blockSize;
-	if( fread( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
+	if( readData( &blockSize, sizeof( XferBlockSize ) ) == FALSE )
 	{
 
 		DEBUG_CRASH(( "Xfer - Error reading block size for '%s'", m_identifier.str() ));
@@ -162,8 +174,17 @@ void XferLoad::skip( Int dataSize )
 	DEBUG_ASSERTCRASH( dataSize >=0, ("XferLoad::skip - dataSize '%d' must be greater than 0",
 										 dataSize) );
 
-	// skip datasize in the file from the current position
-	if( fseek( m_fileFP, dataSize, SEEK_CUR ) != 0 )
+	// skip within the buffer if we can, else drop it and seek the file from the end of the buffer
+	Int buffered = m_bufferEnd - m_bufferPos;
+	if( dataSize <= buffered )
+	{
+		m_bufferPos += dataSize;
+		return;
+	}
+
+	m_bufferPos = 0;
+	m_bufferEnd = 0;
+	if( fseek( m_fileFP, dataSize - buffered, SEEK_CUR ) != 0 )
 		throw XFER_SKIP_ERROR;
 
 }
@@ -248,7 +269,7 @@ void XferLoad::xferImplementation( void *data, Int dataSize )
 										 m_identifier.str()) );
 
 	// read data from file
-	if( fread( data, dataSize, 1, m_fileFP ) != 1 )
+	if( readData( data, dataSize ) == FALSE )
 	{
 
 		DEBUG_CRASH(( "XferLoad - Error reading from file '%s'", m_identifier.str() ));
@@ -258,3 +279,43 @@ void XferLoad::xferImplementation( void *data, Int dataSize )
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Copy 'dataSize' bytes out of the read buffer, refilling it from the file when it runs out.
+	* Returns FALSE if the file ends first */
+//-------------------------------------------------------------------------------------------------
+Bool XferLoad::readData( void *data, Int dataSize )
+{
+	UnsignedByte *dest = static_cast<UnsignedByte *>( data );
+
+	while( dataSize > 0 )
+	{
+
+		Int buffered = m_bufferEnd - m_bufferPos;
+		if( buffered == 0 )
+		{
+
+			// large reads go straight to the destination
+			if( dataSize >= XFER_LOAD_BUFFER_SIZE )
+				return fread( dest, dataSize, 1, m_fileFP ) == 1;
+
+			m_bufferPos = 0;
+			m_bufferEnd = (Int)fread( &m_buffer[ 0 ], 1, m_buffer.size(), m_fileFP );
+			if( m_bufferEnd == 0 )
+				return FALSE;
+
+			buffered = m_bufferEnd;
+
+		}
+
+		Int count = min( buffered, dataSize );
+		memcpy( dest, &m_buffer[ m_bufferPos ], count );
+		m_bufferPos += count;
+		dest += count;
+		dataSize -= count;
+
+	}
+
+	return TRUE;
+
+}
+
@@ -0,0 +1,85 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: XferMemory.cpp ///////////////////////////////////////////////////////////////////////////
+// Desc:   Xfer write implementation that collects the data in memory
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/XferMemory.h"
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferMemorySave::XferMemorySave( void )
+{
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferMemorySave::~XferMemorySave( void )
+{
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Start collecting data. Anything in the buffer from a previous session is thrown away, but its
+	* memory is reused */
+//-------------------------------------------------------------------------------------------------
+void XferMemorySave::open( AsciiString identifier )
+{
+
+	if( m_isOpen )
+	{
+
+		DEBUG_CRASH(( "Cannot open '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_isOpen = TRUE;
+	m_buffer.clear();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Stop collecting data */
+//-------------------------------------------------------------------------------------------------
+void XferMemorySave::close( void )
+{
+
+	if( m_isOpen == FALSE )
+	{
+
+		DEBUG_CRASH(( "Xfer close called, but nothing was open" ));
+		throw XFER_FILE_NOT_OPEN;
+
+	}
+
+	DEBUG_ASSERTCRASH( m_blockStack == nullptr, ("XferMemorySave::close - '%s' has unmatched begin blocks", m_identifier.str()) );
+
+	m_isOpen = FALSE;
+	clearBlockStack();
+	m_identifier.clear();
+
+}
@@ -40,7 +40,7 @@ class XferBlockData : public MemoryPoolObject
 
 public:
 
-	XferFilePos filePos;			///< the file position of this block
+	XferFilePos filePos;			///< the position of this block in the write buffer
 	XferBlockData *next;			///< next block on the stack
 
 };
@@ -52,29 +52,20 @@ EMPTY_DTOR(XferBlockData)
 
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
-XferSave::XferSave( void )
+XferBufferedSave::XferBufferedSave( void )
 {
 
 	m_xferMode = XFER_SAVE;
-	m_fileFP = nullptr;
+	m_isOpen = FALSE;
 	m_blockStack = nullptr;
 
 }
 
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
-XferSave::~XferSave( void )
+XferBufferedSave::~XferBufferedSave( void )
 {
 
-	// warn the user if a file was left open
-	if( m_fileFP != nullptr )
-	{
-
-		DEBUG_CRASH(( "Warning: Xfer file '%s' was left open", m_identifier.str() ));
-		close();
-
-	}
-
 	//
 	// the block stack should be empty, if it's not that means we started blocks but never
 	// called enough matching end blocks
@@ -83,105 +74,33 @@ XferSave::~XferSave( void )
 	{
 
 		// tell the user there is an error
-		DEBUG_CRASH(( "Warning: XferSave::~XferSave - m_blockStack was not null!" ));
+		DEBUG_CRASH(( "Warning: XferBufferedSave::~XferBufferedSave - m_blockStack was not null!" ));
 
 		// delete the block stack
-		XferBlockData *next;
-		while( m_blockStack )
-		{
-
-			next = m_blockStack->next;
-			deleteInstance(m_blockStack);
-			m_blockStack = next;
-
-		}
-
-	}
-
-}
-
-//-------------------------------------------------------------------------------------------------
-/** Open file 'identifier' for writing */
-//-------------------------------------------------------------------------------------------------
-void XferSave::open( AsciiString identifier )
-{
-
-	// sanity, check to see if we're already open
-	if( m_fileFP != nullptr )
-	{
-
-		DEBUG_CRASH(( "Cannot open file '%s' cause we've already got '%s' open",
-									identifier.str(), m_identifier.str() ));
-		throw XFER_FILE_ALREADY_OPEN;
-
-	}
-
-	// call base class
-	Xfer::open( identifier );
-
-	// open the file
-	m_fileFP = fopen( identifier.str(), "w+b" );
-	if( m_fileFP == nullptr )
-	{
-
-		DEBUG_CRASH(( "File '%s' not found", identifier.str() ));
-		throw XFER_FILE_NOT_FOUND;
-
-	}
-
-}
-
-//-------------------------------------------------------------------------------------------------
-/** Close our current file */
-//-------------------------------------------------------------------------------------------------
-void XferSave::close( void )
-{
-
-	// sanity, if we don't have an open file we can do nothing
-	if( m_fileFP == nullptr )
-	{
-
-		DEBUG_CRASH(( "Xfer close called, but no file was open" ));
-		throw XFER_FILE_NOT_OPEN;
+		clearBlockStack();
 
 	}
 
-	// close the file
-	fclose( m_fileFP );
-	m_fileFP = nullptr;
-
-	// erase the filename
-	m_identifier.clear();
-
 }
 
 //-------------------------------------------------------------------------------------------------
-/** Write a placeholder at the current location in the file and store this location
+/** Write a placeholder at the current location in the buffer and store this location
 	* internally.  The next endBlock that is called will back up to the most recently stored
-	* beginBlock and write the difference in file bytes from the endBlock call to the
-	* location of this beginBlock.  The current file position will then return to the location
-	* at which endBlock was called */
+	* beginBlock and write the difference in bytes from the endBlock call to the
+	* location of this beginBlock */
 //-------------------------------------------------------------------------------------------------
-Int XferSave::beginBlock( void )
+Int XferBufferedSave::beginBlock( void )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != nullptr, ("Xfer begin block - file pointer for '%s' is null",
-										 m_identifier.str()) );
+	DEBUG_ASSERTCRASH( m_isOpen, ("Xfer begin block - '%s' is not open", m_identifier.str()) );
 
-	// get the current file position so we can back up here for the next end block call
-	XferFilePos filePos = ftell( m_fileFP );
+	// get the current buffer position so we can back up here for the next end block call
+	XferFilePos filePos = (XferFilePos)m_buffer.size();
 
 	// write a placeholder
 	XferBlockSize blockSize = 0;
-	if( fwrite( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
-	{
-
-		DEBUG_CRASH(( "XferSave::beginBlock - Error writing block size in '%s'",
-									m_identifier.str() ));
-		return XFER_WRITE_ERROR;
-
-	}
+	xferImplementation( &blockSize, sizeof( XferBlockSize ) );
 
 	// save this block position on the top of the "stack"
 	XferBlockData *top = newInstance(XferBlockData);
@@ -203,16 +122,15 @@ Int XferSave::beginBlock( void )
 }
 
 //-------------------------------------------------------------------------------------------------
-/** Do the tail end as described in beginBlock above.  Back up to the last begin block,
-	* write the file difference from current position to the last begin position, and put
-	* current file position back to where it was */
+/** Do the tail end as described in beginBlock above.  Patch the size of the last begin block
+	* in the buffer.  When the outermost block ends, nothing refers back into the buffer anymore
+	* and it is handed to flushBuffer */
 //-------------------------------------------------------------------------------------------------
-void XferSave::endBlock( void )
+void XferBufferedSave::endBlock( void )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != nullptr, ("Xfer end block - file pointer for '%s' is null",
-										 m_identifier.str()) );
+	DEBUG_ASSERTCRASH( m_isOpen, ("Xfer end block - '%s' is not open", m_identifier.str()) );
 
 	// sanity, make sure we have a block started
 	if( m_blockStack == nullptr )
@@ -223,54 +141,43 @@ void XferSave::endBlock( void )
 
 	}
 
-	// save our current file position
-	XferFilePos currentFilePos = ftell( m_fileFP );
+	// save our current buffer position
+	XferFilePos currentFilePos = (XferFilePos)m_buffer.size();
 
 	// pop the block descriptor off the top of the block stack
 	XferBlockData *top = m_blockStack;
 	m_blockStack = m_blockStack->next;
 
-	// rewind the file to the block position
-	fseek( m_fileFP, top->filePos, SEEK_SET );
-
-	// write the size in bytes between the block position and what is our current file position
+	// write the size in bytes between the block position and what is our current position
 	XferBlockSize blockSize = currentFilePos - top->filePos - sizeof( XferBlockSize );
-	if( fwrite( &blockSize, sizeof( XferBlockSize ), 1, m_fileFP ) != 1 )
-	{
-
-		DEBUG_CRASH(( "Error writing block size to file '%s'", m_identifier.str() ));
-		throw XFER_WRITE_ERROR;
-
-	}
-
-	// place the file pointer back to the current position
-	fseek( m_fileFP, currentFilePos, SEEK_SET );
+	memcpy( &m_buffer[ top->filePos ], &blockSize, sizeof( XferBlockSize ) );
 
 	// delete the block data as it's all used up now
 	deleteInstance(top);
 
+	if( m_blockStack == nullptr )
+		flushBuffer();
+
 }
 
 //-------------------------------------------------------------------------------------------------
-/** Skip forward 'dataSize' bytes in the file */
+/** Skip forward 'dataSize' bytes */
 //-------------------------------------------------------------------------------------------------
-void XferSave::skip( Int dataSize )
+void XferBufferedSave::skip( Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != nullptr, ("XferSave - file pointer for '%s' is null",
-										 m_identifier.str()) );
-
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSave - '%s' is not open", m_identifier.str()) );
 
-	// skip forward dataSize bytes
-	fseek( m_fileFP, dataSize, SEEK_CUR );
+	// skip forward dataSize bytes, the skipped bytes read back as zero like a seek past the end of a file
+	m_buffer.resize( m_buffer.size() + dataSize, 0 );
 
 }
 
 // ------------------------------------------------------------------------------------------------
 /** Entry point for xfering a snapshot */
 // ------------------------------------------------------------------------------------------------
-void XferSave::xferSnapshot( Snapshot *snapshot )
+void XferBufferedSave::xferSnapshot( Snapshot *snapshot )
 {
 
 	if( snapshot == nullptr )
@@ -289,7 +196,7 @@ void XferSave::xferSnapshot( Snapshot *snapshot )
 // ------------------------------------------------------------------------------------------------
 /** Save ascii string */
 // ------------------------------------------------------------------------------------------------
-void XferSave::xferAsciiString( AsciiString *asciiStringData )
+void XferBufferedSave::xferAsciiString( AsciiString *asciiStringData )
 {
 
 	// sanity
@@ -314,7 +221,7 @@ void XferSave::xferAsciiString( AsciiString *asciiStringData )
 // ------------------------------------------------------------------------------------------------
 /** Save unicodee string */
 // ------------------------------------------------------------------------------------------------
-void XferSave::xferUnicodeString( UnicodeString *unicodeStringData )
+void XferBufferedSave::xferUnicodeString( UnicodeString *unicodeStringData )
 {
 
 	// sanity
@@ -339,20 +246,181 @@ void XferSave::xferUnicodeString( UnicodeString *unicodeStringData )
 //-------------------------------------------------------------------------------------------------
 /** Perform the write operation */
 //-------------------------------------------------------------------------------------------------
-void XferSave::xferImplementation( void *data, Int dataSize )
+void XferBufferedSave::xferImplementation( void *data, Int dataSize )
 {
 
 	// sanity
-	DEBUG_ASSERTCRASH( m_fileFP != nullptr, ("XferSave - file pointer for '%s' is null",
-										 m_identifier.str()) );
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSave - '%s' is not open", m_identifier.str()) );
+
+	// TheSuperHackers @performance Collect the data in memory, so the block sizes can be patched
+	// without seeking and the file is written in a few large writes instead of one per field.
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>( data );
+	m_buffer.insert( m_buffer.end(), bytes, bytes + dataSize );
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Delete any blocks that were begun but never ended */
+//-------------------------------------------------------------------------------------------------
+void XferBufferedSave::clearBlockStack( void )
+{
+
+	XferBlockData *next;
+	while( m_blockStack )
+	{
+
+		next = m_blockStack->next;
+		deleteInstance(m_blockStack);
+		m_blockStack = next;
+
+	}
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSave::XferSave( void )
+{
+
+	m_fileFP = nullptr;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSave::~XferSave( void )
+{
+
+	// warn the user if a file was left open
+	if( m_fileFP != nullptr )
+	{
+
+		DEBUG_CRASH(( "Warning: Xfer file '%s' was left open", m_identifier.str() ));
+		abandon();
+
+	}
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Open file 'identifier' for writing */
+//-------------------------------------------------------------------------------------------------
+void XferSave::open( AsciiString identifier )
+{
+
+	// sanity, check to see if we're already open
+	if( m_fileFP != nullptr )
+	{
+
+		DEBUG_CRASH(( "Cannot open file '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}
+
+	// call base class
+	Xfer::open( identifier );
+
+	// open the file
+	m_fileFP = fopen( identifier.str(), "w+b" );
+	if( m_fileFP == nullptr )
+	{
+
+		DEBUG_CRASH(( "File '%s' not found", identifier.str() ));
+		throw XFER_FILE_NOT_FOUND;
+
+	}
+
+	m_isOpen = TRUE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Close our current file */
+//-------------------------------------------------------------------------------------------------
+void XferSave::close( void )
+{
+
+	// sanity, if we don't have an open file we can do nothing
+	if( m_fileFP == nullptr )
+	{
+
+		DEBUG_CRASH(( "Xfer close called, but no file was open" ));
+		throw XFER_FILE_NOT_OPEN;
+
+	}
 
-	// write data to file
-	if( fwrite( data, dataSize, 1, m_fileFP ) != 1 )
+	// write what is left in the buffer, unless the save was abandoned in the middle of a block
+	Bool writeFailed = FALSE;
+	if( m_blockStack == nullptr )
+	{
+
+		try
+		{
+			flushBuffer();
+		}
+		catch( ... )
+		{
+			writeFailed = TRUE;
+		}
+
+	}
+	m_buffer.clear();
+
+	// close the file
+	fclose( m_fileFP );
+	m_fileFP = nullptr;
+	m_isOpen = FALSE;
+
+	// erase the filename
+	m_identifier.clear();
+
+	if( writeFailed )
+		throw XFER_WRITE_ERROR;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Close our current file after a failed save. Whatever is still buffered is thrown away and
+	* nothing is written, so unlike close() this never throws and is safe in an error handler */
+//-------------------------------------------------------------------------------------------------
+void XferSave::abandon( void )
+{
+
+	if( m_fileFP == nullptr )
+		return;
+
+	m_buffer.clear();
+	clearBlockStack();
+
+	// close the file
+	fclose( m_fileFP );
+	m_fileFP = nullptr;
+	m_isOpen = FALSE;
+
+	// erase the filename
+	m_identifier.clear();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Write the buffered data to the file */
+//-------------------------------------------------------------------------------------------------
+void XferSave::flushBuffer( void )
+{
+
+	if( m_buffer.empty() )
+		return;
+
+	if( fwrite( &m_buffer[ 0 ], m_buffer.size(), 1, m_fileFP ) != 1 )
 	{
 
 		DEBUG_CRASH(( "XferSave - Error writing to file '%s'", m_identifier.str() ));
+		m_buffer.clear();
 		throw XFER_WRITE_ERROR;
 
 	}
 
+	m_buffer.clear();
+
 }
@@ -59,10 +59,12 @@ const int JobObjectExtendedLimitInformation = 9;
 typedef HANDLE (WINAPI *PFN_CreateJobObjectW)(LPSECURITY_ATTRIBUTES, LPCWSTR);
 typedef BOOL (WINAPI *PFN_SetInformationJobObject)(HANDLE, JOBOBJECTINFOCLASS, LPVOID, DWORD);
 typedef BOOL (WINAPI *PFN_AssignProcessToJobObject)(HANDLE, HANDLE);
+typedef BOOL (WINAPI *PFN_QueryInformationJobObject)(HANDLE, JOBOBJECTINFOCLASS, LPVOID, DWORD, LPDWORD);
 
 static PFN_CreateJobObjectW CreateJobObjectW = (PFN_CreateJobObjectW)GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "CreateJobObjectW");
 static PFN_SetInformationJobObject SetInformationJobObject = (PFN_SetInformationJobObject)GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetInformationJobObject");
 static PFN_AssignProcessToJobObject AssignProcessToJobObject = (PFN_AssignProcessToJobObject)GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "AssignProcessToJobObject");
+static PFN_QueryInformationJobObject QueryInformationJobObject = (PFN_QueryInformationJobObject)GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "QueryInformationJobObject");
 #endif
 
 WorkerProcess::WorkerProcess()
@@ -71,19 +73,26 @@ WorkerProcess::WorkerProcess()
 	m_readHandle = nullptr;
 	m_jobHandle = nullptr;
 	m_exitcode = 0;
+	m_startTimeMillis = 0;
+	m_wallTimeMillis = 0;
+	m_peakMemoryUsed = 0;
 	m_isDone = false;
 }
 
 bool WorkerProcess::startProcess(UnicodeString command)
 {
 	m_stdOutput.clear();
+	m_wallTimeMillis = 0;
+	m_peakMemoryUsed = 0;
 	m_isDone = false;
 
-	// Create pipe for reading console output
+	// Create pipe for reading console output.
+	// The buffer is large enough that the worker does not block on writing while we wait for it in waitForAny.
 	SECURITY_ATTRIBUTES saAttr = { sizeof(SECURITY_ATTRIBUTES) };
 	saAttr.bInheritHandle = TRUE;
 	HANDLE writeHandle = nullptr;
-	if (!CreatePipe(&m_readHandle, &writeHandle, &saAttr, 0))
+	const DWORD pipeBufferSize = 64 * 1024;
+	if (!CreatePipe(&m_readHandle, &writeHandle, &saAttr, pipeBufferSize))
 		return false;
 	SetHandleInformation(m_readHandle, HANDLE_FLAG_INHERIT, 0);
 
@@ -108,6 +117,7 @@ bool WorkerProcess::startProcess(UnicodeString command)
 	CloseHandle(pi.hThread);
 	CloseHandle(writeHandle);
 	m_processHandle = pi.hProcess;
+	m_startTimeMillis = GetTickCount();
 
 	// We want to make sure that when our process is killed, our workers automatically terminate as well.
 	// In Windows, the way to do this is to attach the worker to a job we own.
@@ -189,18 +199,38 @@ void WorkerProcess::update()
 	// Pipe broke, that means the process already exited. But we call this just to make sure
 	WaitForSingleObject(m_processHandle, INFINITE);
 	GetExitCodeProcess(m_processHandle, &m_exitcode);
+	m_wallTimeMillis = GetTickCount() - m_startTimeMillis;
 	CloseHandle(m_processHandle);
 	m_processHandle = nullptr;
 
 	CloseHandle(m_readHandle);
 	m_readHandle = nullptr;
 
-	CloseHandle(m_jobHandle);
-	m_jobHandle = nullptr;
+	if (m_jobHandle != nullptr)
+	{
+		m_peakMemoryUsed = getPeakMemoryUsed();
+		CloseHandle(m_jobHandle);
+		m_jobHandle = nullptr;
+	}
 
 	m_isDone = true;
 }
 
+SIZE_T WorkerProcess::getPeakMemoryUsed() const
+{
+	if (m_jobHandle == nullptr)
+		return m_peakMemoryUsed;
+
+	// The job only ever contains this worker, so its peak is the peak of the worker
+	JOBOBJECT_EXTENDED_LIMIT_INFORMATION jobInfo = { 0 };
+	if (QueryInformationJobObject != nullptr
+		&& QueryInformationJobObject(m_jobHandle, (JOBOBJECTINFOCLASS)JobObjectExtendedLimitInformation, &jobInfo, sizeof(jobInfo), nullptr))
+	{
+		return jobInfo.PeakProcessMemoryUsed;
+	}
+	return m_peakMemoryUsed;
+}
+
 void WorkerProcess::kill()
 {
 	if (!isRunning())
@@ -229,3 +259,19 @@ void WorkerProcess::kill()
 	m_isDone = false;
 }
 
+void WorkerProcess::waitForAny(const std::vector<WorkerProcess>& processes, DWORD timeoutMillis)
+{
+	HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+	DWORD numHandles = 0;
+	for (size_t i = 0; i < processes.size() && numHandles < MAXIMUM_WAIT_OBJECTS; ++i)
+	{
+		if (processes[i].m_processHandle != nullptr)
+			handles[numHandles++] = processes[i].m_processHandle;
+	}
+
+	if (numHandles == 0)
+		return;
+
+	// The timeout only matters for draining console output of workers that are still running
+	WaitForMultipleObjects(numHandles, handles, FALSE, timeoutMillis);
+}
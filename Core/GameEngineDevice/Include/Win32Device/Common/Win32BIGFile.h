@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <windows.h>
+
 #include "Common/ArchiveFile.h"
 #include "Common/AsciiString.h"
 #include "Common/List.h"
@@ -46,8 +48,19 @@ class Win32BIGFile : public ArchiveFile
 		virtual void					setSearchPriority( Int new_priority );	///< Set this BIG file's search priority
 		virtual void					close( void );													///< Close this BIG file
 
+		// TheSuperHackers @performance Map the whole BIG file into memory read only. Files opened
+		// from a mapped BIG file are views into the mapping instead of copies.
+		Bool									mapFile( const Char *filename );
+		const Char*						getMappedData( void ) const { return m_mappedData; }	///< nullptr if not mapped
+		UnsignedInt						getMappedSize( void ) const { return m_mappedSize; }
+
 	protected:
 
+		void									unmapFile( void );
+
 		AsciiString		m_name;		///< BIG file name
 		AsciiString		m_path;		///< BIG file path
+		HANDLE				m_mappingHandle;
+		const Char*		m_mappedData;
+		UnsignedInt		m_mappedSize;
 };
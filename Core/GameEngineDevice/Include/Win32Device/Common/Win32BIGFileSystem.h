@@ -52,4 +52,12 @@ public:
 	virtual Bool loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite = FALSE);
 protected:
 
+	// TheSuperHackers @performance Archives are memory mapped until this much address space is used
+	// by them, the remaining ones are read from disk as before. This is a 32 bit process with 2 GB of
+	// address space that textures, models, audio and the memory pools also need in contiguous ranges,
+	// so the archives may only take a small share of it.
+	enum { MaxMappedArchiveBytes = 256 * 1024 * 1024 };
+
+	UnsignedInt m_mappedArchiveBytes;	///< size of all archives that are memory mapped
+
 };
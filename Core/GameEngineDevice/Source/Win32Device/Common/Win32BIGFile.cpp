@@ -41,6 +41,9 @@
 Win32BIGFile::Win32BIGFile(AsciiString name, AsciiString path)
 	: m_name(name)
 	, m_path(path)
+	, m_mappingHandle(nullptr)
+	, m_mappedData(nullptr)
+	, m_mappedSize(0)
 {
 
 }
@@ -51,7 +54,65 @@ Win32BIGFile::Win32BIGFile(AsciiString name, AsciiString path)
 
 Win32BIGFile::~Win32BIGFile()
 {
+	unmapFile();
+}
+
+//============================================================================
+// Win32BIGFile::mapFile
+//============================================================================
+
+Bool Win32BIGFile::mapFile( const Char *filename )
+{
+	DEBUG_ASSERTCRASH(m_mappedData == nullptr, ("Win32BIGFile::mapFile - %s is already mapped", filename));
+
+	HANDLE fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE) {
+		return FALSE;
+	}
+
+	DWORD sizeHigh = 0;
+	const DWORD sizeLow = GetFileSize(fileHandle, &sizeHigh);
+	if (sizeLow == INVALID_FILE_SIZE || sizeLow == 0 || sizeHigh != 0) {
+		CloseHandle(fileHandle);
+		return FALSE;
+	}
+
+	// the mapping keeps the file open, so the file handle is not needed anymore
+	m_mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(fileHandle);
+	if (m_mappingHandle == nullptr) {
+		return FALSE;
+	}
+
+	// This can fail if the address space has no room left for it, the caller falls back to reading the file then
+	m_mappedData = (const Char *)MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	if (m_mappedData == nullptr) {
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = nullptr;
+		return FALSE;
+	}
 
+	m_mappedSize = sizeLow;
+	return TRUE;
+}
+
+//============================================================================
+// Win32BIGFile::unmapFile
+//============================================================================
+
+void Win32BIGFile::unmapFile( void )
+{
+	if (m_mappedData != nullptr) {
+		UnmapViewOfFile(m_mappedData);
+		m_mappedData = nullptr;
+	}
+
+	if (m_mappingHandle != nullptr) {
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = nullptr;
+	}
+
+	m_mappedSize = 0;
 }
 
 //============================================================================
@@ -68,6 +129,23 @@ File* Win32BIGFile::openFile( const Char *filename, Int access )
 
 	RAMFile *ramFile = nullptr;
 
+	// Read only files of a mapped BIG file are served straight from the mapping. Streamed files keep
+	// reading through m_file in small pieces, as the whole point is not to touch all of the data.
+	if (m_mappedData != nullptr && !BitIsSet(access, File::STREAMING) && !BitIsSet(access, File::WRITE)) {
+		if (fileInfo->m_offset > m_mappedSize || fileInfo->m_size > m_mappedSize - fileInfo->m_offset) {
+			DEBUG_CRASH(("Win32BIGFile::openFile - %s is outside of %s", filename, m_name.str()));
+			return nullptr;
+		}
+
+		ramFile = newInstance( RAMFile );
+		ramFile->deleteOnClose();
+		if (ramFile->openView(fileInfo->m_filename, m_mappedData + fileInfo->m_offset, (Int)fileInfo->m_size) == FALSE) {
+			ramFile->close();
+			return nullptr;
+		}
+		return ramFile;
+	}
+
 	if (BitIsSet(access, File::STREAMING))
 		ramFile = newInstance( StreamingArchiveFile );
 	else
@@ -45,7 +45,7 @@
 
 static const char *BIGFileIdentifier = "BIGF";
 
-Win32BIGFileSystem::Win32BIGFileSystem() : ArchiveFileSystem() {
+Win32BIGFileSystem::Win32BIGFileSystem() : ArchiveFileSystem(), m_mappedArchiveBytes(0) {
 }
 
 Win32BIGFileSystem::~Win32BIGFileSystem() {
@@ -57,6 +57,8 @@ void Win32BIGFileSystem::init() {
 		return;
 	}
 
+	const DWORD startTimeMillis = GetTickCount();
+
 	loadBigFilesFromDirectory("", "*.big");
 
 #if RTS_ZEROHOUR
@@ -68,6 +70,9 @@ void Win32BIGFileSystem::init() {
     if (!installPath.isEmpty())
       loadBigFilesFromDirectory(installPath, "*.big");
 #endif
+
+	DEBUG_LOG(("Win32BIGFileSystem::init - mounted %d BIG files in %d msec, %u of their bytes are memory mapped",
+		(Int)m_archiveFileMap.size(), (Int)(GetTickCount() - startTimeMillis), m_mappedArchiveBytes));
 }
 
 void Win32BIGFileSystem::reset() {
@@ -86,6 +91,7 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 	archiveFileName.toLower();
 	Int archiveFileSize = 0;
 	Int numLittleFiles = 0;
+	Int headerSize = 0;
 
 	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - opening BIG file %s", filename));
 
@@ -94,7 +100,6 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 		return nullptr;
 	}
 
-	AsciiString asciibuf;
 	char buffer[_MAX_PATH];
 	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
 	buffer[4] = 0;
@@ -110,32 +115,67 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 
 	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - size of archive file is %d bytes", archiveFileSize));
 
-//	char t;
-
 	// read in the number of files contained in this BIG file.
 	// change the order of the bytes cause the file size is in reverse byte order for some reason.
 	fp->read(&numLittleFiles, 4);
 	numLittleFiles = betoh(numLittleFiles);
 
+	// read in the size of the header, which is where the data of the first file starts.
+	fp->read(&headerSize, 4);
+	headerSize = betoh(headerSize);
+
 	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - %d are contained in archive", numLittleFiles));
-//	for (Int i = 0; i < 2; ++i) {
-//		t = buffer[i];
-//		buffer[i] = buffer[(4-i)-1];
-//		buffer[(4-i)-1] = t;
-//	}
-
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
-	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
+
 	// TheSuperHackers @fix Mauller 23/04/2025 Create new file handle when necessary to prevent memory leak
-	ArchiveFile *archiveFile = NEW Win32BIGFile(filename, AsciiString::TheEmptyString);
+	Win32BIGFile *archiveFile = NEW Win32BIGFile(filename, AsciiString::TheEmptyString);
+
+	// TheSuperHackers @performance Map the archive if it still fits the budget, so its files are
+	// served without copies, and parse the directory listing in one go instead of one byte at a time.
+	const Int actualFileSize = fp->size();
+	if (actualFileSize > 0 && (UnsignedInt)actualFileSize <= MaxMappedArchiveBytes - m_mappedArchiveBytes) {
+		if (archiveFile->mapFile(filename)) {
+			m_mappedArchiveBytes += archiveFile->getMappedSize();
+		}
+	}
+
+	const Char *directory = nullptr;
+	Int directorySize = 0;
+	Char *directoryBuffer = nullptr;
+
+	if (archiveFile->getMappedData() != nullptr) {
+		directory = archiveFile->getMappedData() + 0x10;
+		directorySize = (Int)archiveFile->getMappedSize() - 0x10;
+	} else {
+		// The header size is only a hint, old tools do not always fill it in. The listing can never be
+		// larger than one maximum length entry per file, nor larger than the file itself.
+		directorySize = headerSize - 0x10;
+		if (directorySize <= 0 || headerSize > actualFileSize) {
+			directorySize = min(numLittleFiles * (8 + _MAX_PATH), actualFileSize - 0x10);
+		}
+		directorySize = max(directorySize, 0);
+
+		// seek to the beginning of the directory listing and read all of it.
+		directoryBuffer = NEW Char[directorySize + 1];
+		fp->seek(0x10, File::START);
+		directorySize = max(fp->read(directoryBuffer, directorySize), 0);
+		directory = directoryBuffer;
+	}
+
+	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
+	const Char *pos = directory;
+	const Char *end = directory + directorySize;
 
 	for (Int i = 0; i < numLittleFiles; ++i) {
+		if (end - pos < 8) {
+			DEBUG_CRASH(("Win32BIGFileSystem::openArchiveFile - directory of %s is truncated", filename));
+			break;
+		}
+
 		Int filesize = 0;
 		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
+		memcpy(&fileOffset, pos, 4);
+		memcpy(&filesize, pos + 4, 4);
+		pos += 8;
 
 		filesize = betoh(filesize);
 		fileOffset = betoh(fileOffset);
@@ -145,11 +185,15 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 		fileInfo->m_size = filesize;
 
 		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
+		const Char *pathEnd = (const Char *)memchr(pos, 0, min(end - pos, (ptrdiff_t)_MAX_PATH));
+		if (pathEnd == nullptr) {
+			DEBUG_CRASH(("Win32BIGFileSystem::openArchiveFile - bad path name in directory of %s", filename));
+			break;
+		}
+
+		const Int pathIndex = (Int)(pathEnd - pos);
+		memcpy(buffer, pos, pathIndex + 1);
+		pos = pathEnd + 1;
 
 		Int filenameIndex = pathIndex;
 		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
@@ -163,14 +207,12 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 		AsciiString path;
 		path = buffer;
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
-
 		archiveFile->addFile(path, fileInfo);
 	}
 
+	delete [] directoryBuffer;
+	directoryBuffer = nullptr;
+
 	archiveFile->attachFile(fp);
 
 	delete fileInfo;
@@ -198,6 +240,7 @@ void Win32BIGFileSystem::closeArchiveFile(const Char *filename) {
 
 	// may need to do some other processing here first.
 
+	m_mappedArchiveBytes -= static_cast<Win32BIGFile *>(it->second)->getMappedSize();
 	delete (it->second);
 	m_archiveFileMap.erase(it);
 }
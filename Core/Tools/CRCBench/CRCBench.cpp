@@ -0,0 +1,294 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: CRCBench.cpp /////////////////////////////////////////////////////////////////////////////
+// Desc:   Correctness check and benchmark for the logic CRC (XferCRC) and the packet CRC (CRC).
+//         Both are compared against the original one step at a time loops on random buffers of
+//         every length up to 256 bytes, each after a random starting CRC. Then the throughput of
+//         the engine loops and the original loops is measured on a large buffer. Fails if any
+//         result differs from the original loop.
+//
+// Usage:  crcbench [-buffers N] [-mb N]
+//         -buffers  random buffers to check (default 20000)
+//         -mb       megabytes to CRC per throughput measurement (default 256)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/AsciiString.h"
+#include "Common/crc.h"
+#include "Common/GameMemory.h"
+#include "Common/XferCRC.h"
+#include "Utility/endian_compat.h"
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////////////////////////
+enum
+{
+	MAX_CHECK_LENGTH = 256,						///< longest random buffer that is checked
+	BENCH_BUFFER_SIZE = 1024 * 1024		///< buffer that is CRCed repeatedly for the throughput
+};
+
+static volatile UnsignedInt s_sink = 0;		///< keeps the compiler from dropping the timed loops
+
+// PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = nullptr;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = nullptr;
+
+const char *gAppPrefix = "CB_";
+
+// Where are the default string files?
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt nextRandom(UnsignedInt &seed)
+{
+	seed = seed * 1664525 + 1013904223;
+	return seed >> 8;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The original XferCRC::xferImplementation, which stored the CRC after every word */
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt referenceLogicCRC(UnsignedInt crc, const void *data, Int dataSize)
+{
+	const UnsignedInt *uintPtr = (const UnsignedInt *)data;
+
+	for (Int i = 0; i < dataSize / 4; ++i)
+	{
+		crc = (crc << 1) + htobe(*uintPtr++) + ((crc >> 31) & 0x01);
+	}
+
+	const unsigned char *c = (const unsigned char *)uintPtr;
+	const Int tail = dataSize & 3;
+
+	if (tail > 0)
+	{
+		UnsignedInt val = c[0];
+		if (tail > 1)
+			val += (c[1] << 8);
+		if (tail > 2)
+			val += (c[2] << 16);
+		crc = (crc << 1) + val + ((crc >> 31) & 0x01);
+	}
+
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The original C++ loop of CRC::computeCRC, one byte at a time */
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt referencePacketCRC(UnsignedInt crc, const void *buf, Int len)
+{
+	for (const UnsignedByte *bytePtr = (const UnsignedByte *)buf; len > 0; len--, bytePtr++)
+	{
+		const UnsignedInt hibit = (crc & 0x80000000) ? 1 : 0;
+		crc <<= 1;
+		crc += *bytePtr;
+		crc += hibit;
+	}
+	return crc;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** XferCRC starts at zero, so the random starting CRC is fed in as the first word */
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt engineLogicCRC(UnsignedInt startWord, void *data, Int dataSize)
+{
+	XferCRC xfer;
+	xfer.open("CRCBench");
+	xfer.xferUnsignedInt(&startWord);
+	xfer.xferUser(data, dataSize);
+	xfer.close();
+	return betoh(xfer.getCRC());
+}
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt enginePacketCRC(const UnsignedByte *startBytes, const void *buf, Int len)
+{
+	CRC crc;
+	crc.computeCRC(startBytes, 4);
+	crc.computeCRC(buf, len);
+	return crc.get();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Compare both CRCs against the original loops, returns the number of differing results */
+//-------------------------------------------------------------------------------------------------
+static Int checkBuffers(Int numBuffers)
+{
+	UnsignedByte buffer[MAX_CHECK_LENGTH + 4];
+	UnsignedInt seed = 0x1234567;
+	Int errors = 0;
+
+	for (Int n = 0; n < numBuffers; ++n)
+	{
+		const Int length = n % (MAX_CHECK_LENGTH + 1);
+		const Int offset = (n / (MAX_CHECK_LENGTH + 1)) & 3;	// also check unaligned buffers
+		UnsignedByte *data = buffer + offset;
+		for (Int i = 0; i < length; ++i)
+			data[i] = (UnsignedByte)nextRandom(seed);
+
+		UnsignedInt startWord = nextRandom(seed) ^ (nextRandom(seed) << 24);
+		UnsignedByte startBytes[4];
+		memcpy(startBytes, &startWord, 4);
+
+		const UnsignedInt logicExpected = referenceLogicCRC(referenceLogicCRC(0, &startWord, 4), data, length);
+		const UnsignedInt logicResult = engineLogicCRC(startWord, data, length);
+		if (logicResult != logicExpected)
+		{
+			printf("XferCRC differs for length %d: %08X instead of %08X\n", length, logicResult, logicExpected);
+			++errors;
+		}
+
+		const UnsignedInt packetExpected = referencePacketCRC(referencePacketCRC(0, startBytes, 4), data, length);
+		const UnsignedInt packetResult = enginePacketCRC(startBytes, data, length);
+		if (packetResult != packetExpected)
+		{
+			printf("CRC differs for length %d: %08X instead of %08X\n", length, packetResult, packetExpected);
+			++errors;
+		}
+	}
+
+	return errors;
+}
+
+//-------------------------------------------------------------------------------------------------
+static double elapsedMsec(const LARGE_INTEGER &start)
+{
+	LARGE_INTEGER frequency, end;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&end);
+	return 1000.0 * (double)(end.QuadPart - start.QuadPart) / (double)frequency.QuadPart;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void printThroughput(const char *name, double msec, Int megabytes)
+{
+	printf("%s, %.1f, %.1f\n", name, msec, (double)megabytes * 1000.0 / max(msec, 0.001));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Time the engine loops and the original loops over the same buffer */
+//-------------------------------------------------------------------------------------------------
+static void benchmark(Int megabytes)
+{
+	UnsignedByte *buffer = new UnsignedByte[BENCH_BUFFER_SIZE];
+	UnsignedInt seed = 0x7654321;
+	for (Int i = 0; i < BENCH_BUFFER_SIZE; ++i)
+		buffer[i] = (UnsignedByte)nextRandom(seed);
+
+	LARGE_INTEGER start;
+
+	printf("loop, msec, MB per sec\n");
+
+	{
+		XferCRC xfer;
+		xfer.open("CRCBench");
+		QueryPerformanceCounter(&start);
+		for (Int i = 0; i < megabytes; ++i)
+			xfer.xferUser(buffer, BENCH_BUFFER_SIZE);
+		printThroughput("XferCRC", elapsedMsec(start), megabytes);
+		s_sink += xfer.getCRC();
+		xfer.close();
+	}
+
+	{
+		UnsignedInt crc = 0;
+		QueryPerformanceCounter(&start);
+		for (Int i = 0; i < megabytes; ++i)
+			crc = referenceLogicCRC(crc, buffer, BENCH_BUFFER_SIZE);
+		printThroughput("original XferCRC", elapsedMsec(start), megabytes);
+		s_sink += crc;
+	}
+
+	{
+		CRC crc;
+		QueryPerformanceCounter(&start);
+		for (Int i = 0; i < megabytes; ++i)
+			crc.computeCRC(buffer, BENCH_BUFFER_SIZE);
+		printThroughput("CRC", elapsedMsec(start), megabytes);
+		s_sink += crc.get();
+	}
+
+	{
+		UnsignedInt crc = 0;
+		QueryPerformanceCounter(&start);
+		for (Int i = 0; i < megabytes; ++i)
+			crc = referencePacketCRC(crc, buffer, BENCH_BUFFER_SIZE);
+		printThroughput("original CRC", elapsedMsec(start), megabytes);
+		s_sink += crc;
+	}
+
+	delete [] buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	Int numBuffers = 20000;
+	Int megabytes = 256;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (stricmp(argv[i], "-buffers") == 0 && i + 1 < argc)
+			numBuffers = atoi(argv[++i]);
+		else if (stricmp(argv[i], "-mb") == 0 && i + 1 < argc)
+			megabytes = atoi(argv[++i]);
+	}
+	numBuffers = max(numBuffers, 1);
+	megabytes = max(megabytes, 1);
+
+	initMemoryManager();
+
+	int result = 0;
+
+	try
+	{
+		const Int errors = checkBuffers(numBuffers);
+		printf("%d buffers checked, %d differing results\n", numBuffers, errors);
+		if (errors != 0)
+			result = 1;
+
+		benchmark(megabytes);
+	}
+	catch (...)
+	{
+		printf("CRCBench failed\n");
+		result = 1;
+	}
+
+	shutdownMemoryManager();
+
+	return result;
+}
@@ -0,0 +1,344 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: MemoryPoolStress.cpp /////////////////////////////////////////////////////////////////////
+// Desc:   Multithreaded stress test and benchmark for the memory pools and the dynamic memory
+//         allocator. Every thread allocates and frees random sizes, stamps each block and checks
+//         the stamp before freeing it, and hands some blocks to other threads to free. Reports
+//         the allocations and frees per second for 1, 2, 4... threads, and fails if a stamp was
+//         damaged or blocks are still in use after all threads exited.
+//
+// Usage:  memorypoolstress [-threads N] [-ops N]
+//         -threads  highest thread count to run (default 4)
+//         -ops      allocations and frees per thread and run (default 2000000)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/CriticalSection.h"
+#include "Common/Debug.h"
+#include "Common/GameMemory.h"
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////////////////////////
+enum
+{
+	LIVE_BLOCKS = 512,				///< blocks each thread can hold at once
+	HANDOFF_SLOTS = 64,				///< blocks waiting to be freed by another thread
+	HANDOFF_ODDS = 16,				///< one in this many allocations is handed to another thread
+	NUM_STRESS_POOLS = 2,
+	MAX_BLOCK_SIZE = 4096
+};
+
+static const UnsignedInt STAMP = 0x5AFEB10C;
+
+struct StressBlock
+{
+	void *ptr;
+	Int pool;		///< index into s_pools, or -1 if the block came from TheDynamicMemoryAllocator
+};
+
+struct StressThreadData
+{
+	UnsignedInt seed;
+	Int ops;
+};
+
+static const char *s_poolNames[NUM_STRESS_POOLS] = { "MemoryPoolStress32", "MemoryPoolStress96" };
+static const Int s_poolSizes[NUM_STRESS_POOLS] = { 32, 96 };
+static const Int s_dmaSizes[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 512, 1024, MAX_BLOCK_SIZE };
+
+static MemoryPool *s_pools[NUM_STRESS_POOLS];
+static void * volatile s_handoff[HANDOFF_SLOTS];
+static volatile LONG s_errors = 0;
+
+static CriticalSection critSec1, critSec2, critSec3, critSec4, critSec5;
+
+// PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = nullptr;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = nullptr;
+
+const char *gAppPrefix = "MS_";
+
+// Where are the default string files?
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt nextRandom(UnsignedInt &seed)
+{
+	seed = seed * 1664525 + 1013904223;
+	return seed >> 8;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Write the size of the block to its first word and a check value to its last word */
+//-------------------------------------------------------------------------------------------------
+static void stampBlock(void *ptr, Int size)
+{
+	UnsignedInt *words = (UnsignedInt *)ptr;
+	words[0] = size;
+	words[size / sizeof(UnsignedInt) - 1] = size ^ STAMP;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Return the size stamped into the block, or 0 and count an error if the stamp is damaged */
+//-------------------------------------------------------------------------------------------------
+static Int checkBlock(void *ptr)
+{
+	const UnsignedInt *words = (const UnsignedInt *)ptr;
+	const UnsignedInt size = words[0];
+	if (size < 2 * sizeof(UnsignedInt) || size > MAX_BLOCK_SIZE || (size % sizeof(UnsignedInt)) != 0
+		|| words[size / sizeof(UnsignedInt) - 1] != (size ^ STAMP))
+	{
+		InterlockedIncrement(&s_errors);
+		return 0;
+	}
+	return size;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void *allocateDmaBlock(UnsignedInt r)
+{
+	const Int size = s_dmaSizes[r % (sizeof(s_dmaSizes) / sizeof(s_dmaSizes[0]))];
+	void *ptr = TheDynamicMemoryAllocator->allocateBytesDoNotZero(size, "MemoryPoolStress");
+	stampBlock(ptr, size);
+	return ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void freeDmaBlock(void *ptr)
+{
+	checkBlock(ptr);
+	TheDynamicMemoryAllocator->freeBytes(ptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+static void allocateStressBlock(StressBlock &block, UnsignedInt r)
+{
+	if ((r & 3) == 0)
+	{
+		block.pool = (r >> 2) % NUM_STRESS_POOLS;
+		block.ptr = s_pools[block.pool]->allocateBlockDoNotZero("MemoryPoolStress");
+		stampBlock(block.ptr, s_pools[block.pool]->getAllocationSize());
+	}
+	else
+	{
+		block.pool = -1;
+		block.ptr = allocateDmaBlock(r >> 2);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+static void freeStressBlock(StressBlock &block)
+{
+	if (block.pool >= 0)
+	{
+		checkBlock(block.ptr);
+		s_pools[block.pool]->freeBlock(block.ptr);
+	}
+	else
+	{
+		freeDmaBlock(block.ptr);
+	}
+	block.ptr = nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+static DWORD WINAPI stressThread(LPVOID param)
+{
+	const StressThreadData *data = (const StressThreadData *)param;
+	UnsignedInt seed = data->seed;
+
+	StressBlock blocks[LIVE_BLOCKS];
+	memset(blocks, 0, sizeof(blocks));
+
+	try
+	{
+		for (Int op = 0; op < data->ops; ++op)
+		{
+			const UnsignedInt r = nextRandom(seed);
+			StressBlock &block = blocks[r % LIVE_BLOCKS];
+
+			if (block.ptr != nullptr)
+			{
+				freeStressBlock(block);
+			}
+			else if ((r >> 9) % HANDOFF_ODDS == 0)
+			{
+				// free a block that another thread allocated, or leave one for another thread to free.
+				void * volatile *handoff = &s_handoff[(r >> 13) % HANDOFF_SLOTS];
+				void *other = InterlockedExchangePointer((PVOID volatile *)handoff, nullptr);
+				if (other == nullptr)
+					other = InterlockedExchangePointer((PVOID volatile *)handoff, allocateDmaBlock(r >> 2));
+				if (other != nullptr)
+					freeDmaBlock(other);
+			}
+			else
+			{
+				allocateStressBlock(block, r >> 9);
+			}
+		}
+
+		for (Int i = 0; i < LIVE_BLOCKS; ++i)
+		{
+			if (blocks[i].ptr != nullptr)
+				freeStressBlock(blocks[i]);
+		}
+	}
+	catch (...)
+	{
+		InterlockedIncrement(&s_errors);
+	}
+
+	return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Run the given number of threads to completion and return the milliseconds it took */
+//-------------------------------------------------------------------------------------------------
+static double runThreads(Int numThreads, Int ops)
+{
+	HANDLE threads[MAXIMUM_WAIT_OBJECTS];
+	StressThreadData data[MAXIMUM_WAIT_OBJECTS];
+
+	LARGE_INTEGER frequency, start, end;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+
+	Int started = 0;
+	for (Int i = 0; i < numThreads; ++i)
+	{
+		data[i].seed = 0x1234567 + 7919 * (UnsignedInt)(i + numThreads * MAXIMUM_WAIT_OBJECTS);
+		data[i].ops = ops;
+		threads[started] = CreateThread(nullptr, 0, stressThread, &data[i], 0, nullptr);
+		if (threads[started] != nullptr)
+			++started;
+		else
+			InterlockedIncrement(&s_errors);
+	}
+
+	WaitForMultipleObjects(started, threads, TRUE, INFINITE);
+	QueryPerformanceCounter(&end);
+
+	for (Int i = 0; i < started; ++i)
+		CloseHandle(threads[i]);
+
+	return 1000.0 * (double)(end.QuadPart - start.QuadPart) / (double)frequency.QuadPart;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	Int maxThreads = 4;
+	Int ops = 2000000;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (stricmp(argv[i], "-threads") == 0 && i + 1 < argc)
+			maxThreads = atoi(argv[++i]);
+		else if (stricmp(argv[i], "-ops") == 0 && i + 1 < argc)
+			ops = atoi(argv[++i]);
+	}
+	maxThreads = max(1, min(maxThreads, (Int)MAXIMUM_WAIT_OBJECTS));
+	ops = max(ops, 1);
+
+	// the pools are only thread safe once these exist, the same as in the game.
+	TheAsciiStringCriticalSection = &critSec1;
+	TheUnicodeStringCriticalSection = &critSec2;
+	TheDmaCriticalSection = &critSec3;
+	TheMemoryPoolCriticalSection = &critSec4;
+	TheDebugLogCriticalSection = &critSec5;
+
+	initMemoryManager();
+
+	int result = 0;
+
+	try
+	{
+		for (Int i = 0; i < NUM_STRESS_POOLS; ++i)
+			s_pools[i] = TheMemoryPoolFactory->createMemoryPool(s_poolNames[i], s_poolSizes[i], 256, 256);
+
+		printf("threads, msec, allocs and frees per sec\n");
+		for (Int numThreads = 1; ; numThreads = min(numThreads * 2, maxThreads))
+		{
+			const double msec = runThreads(numThreads, ops);
+			printf("%d, %.1f, %.0f\n", numThreads, msec, (double)numThreads * ops * 1000.0 / max(msec, 0.001));
+			if (numThreads == maxThreads)
+				break;
+		}
+
+		for (Int i = 0; i < HANDOFF_SLOTS; ++i)
+		{
+			if (s_handoff[i] != nullptr)
+			{
+				freeDmaBlock(s_handoff[i]);
+				s_handoff[i] = nullptr;
+			}
+		}
+
+		// every thread that allocated has exited, so no blocks may be left in thread caches
+		// except the ones of this thread, which releaseEmpties gives back.
+		for (Int i = 0; i < NUM_STRESS_POOLS; ++i)
+		{
+			s_pools[i]->releaseEmpties();
+			if (s_pools[i]->getUsedBlockCount() != 0)
+			{
+				printf("%s: %d blocks still in use after all threads exited\n", s_poolNames[i], s_pools[i]->getUsedBlockCount());
+				result = 1;
+			}
+			TheMemoryPoolFactory->destroyMemoryPool(s_pools[i]);
+			s_pools[i] = nullptr;
+		}
+	}
+	catch (...)
+	{
+		printf("MemoryPoolStress failed\n");
+		result = 1;
+	}
+
+	if (s_errors != 0)
+	{
+		printf("%d damaged blocks or failed allocations\n", (Int)s_errors);
+		result = 1;
+	}
+
+	shutdownMemoryManager();
+
+	TheAsciiStringCriticalSection = nullptr;
+	TheUnicodeStringCriticalSection = nullptr;
+	TheDmaCriticalSection = nullptr;
+	TheMemoryPoolCriticalSection = nullptr;
+	TheDebugLogCriticalSection = nullptr;
+
+	return result;
+}
@@ -0,0 +1,138 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// TheSuperHackers @feature Compares the logic snapshots that two runs of -simReplay -replaySnapshots
+// wrote for the same replay, and reports the first snapshot frame whose state differs. The state
+// diverged between the previous snapshot frame and that one, so only this interval needs a rerun
+// with CRC logging. Snapshots cannot be loaded back into the game, this only compares the files.
+//
+// Usage: replaysnapshotdiff <snapshotDirA> <snapshotDirB>
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+//-------------------------------------------------------------------------------------------------
+static bool readFile(const std::string& path, std::vector<unsigned char>& data)
+{
+	data.clear();
+	FILE *fp = fopen(path.c_str(), "rb");
+	if (fp == nullptr)
+		return false;
+
+	fseek(fp, 0, SEEK_END);
+	const long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	bool ok = size >= 0;
+	if (ok && size > 0)
+	{
+		data.resize(size);
+		ok = fread(&data[0], size, 1, fp) == 1;
+	}
+	fclose(fp);
+	return ok;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Snapshot file names end in the zero padded frame, so sorting them by name sorts each replay by frame
+static void findSnapshots(const std::string& dir, std::vector<std::string>& names)
+{
+	names.clear();
+	WIN32_FIND_DATAA findData;
+	HANDLE handle = FindFirstFileA((dir + "\\*.snapshot").c_str(), &findData);
+	if (handle == INVALID_HANDLE_VALUE)
+		return;
+
+	do
+	{
+		if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+			names.push_back(findData.cFileName);
+	}
+	while (FindNextFileA(handle, &findData));
+
+	FindClose(handle);
+	std::sort(names.begin(), names.end());
+}
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	if (argc != 3)
+	{
+		printf("Usage: replaysnapshotdiff <snapshotDirA> <snapshotDirB>\n");
+		return 2;
+	}
+
+	const std::string dirA = argv[1];
+	const std::string dirB = argv[2];
+
+	std::vector<std::string> names;
+	findSnapshots(dirA, names);
+	if (names.empty())
+	{
+		printf("No snapshots found in \"%s\"\n", dirA.c_str());
+		return 2;
+	}
+
+	std::vector<unsigned char> dataA;
+	std::vector<unsigned char> dataB;
+	const std::string *lastEqual = nullptr;
+	int compared = 0;
+
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		const std::string& name = names[i];
+		if (!readFile(dirA + "\\" + name, dataA))
+		{
+			printf("Cannot read \"%s\\%s\"\n", dirA.c_str(), name.c_str());
+			return 2;
+		}
+		if (!readFile(dirB + "\\" + name, dataB))
+		{
+			printf("Skipping \"%s\", it is missing in \"%s\"\n", name.c_str(), dirB.c_str());
+			continue;
+		}
+		++compared;
+
+		const size_t common = std::min(dataA.size(), dataB.size());
+		size_t offset = 0;
+		while (offset < common && dataA[offset] == dataB[offset])
+			++offset;
+
+		if (offset == common && dataA.size() == dataB.size())
+		{
+			lastEqual = &name;
+			continue;
+		}
+
+		printf("First differing snapshot: %s\n", name.c_str());
+		printf("First differing byte offset: %u (sizes %u and %u)\n", (unsigned)offset, (unsigned)dataA.size(), (unsigned)dataB.size());
+		if (lastEqual != nullptr)
+			printf("Last equal snapshot: %s\n", lastEqual->c_str());
+		else
+			printf("No earlier equal snapshot, the states diverged before the oldest kept snapshot\n");
+		return 1;
+	}
+
+	printf("%d snapshots compared, all equal\n", compared);
+	return compared > 0 ? 0 : 2;
+}
@@ -131,6 +131,7 @@ public:
 	void logPlayerDisconnect(UnicodeString player, Int slot);
 	void logCRCMismatch( void );
 	Bool sawCRCMismatch() const;
+	Int getCRCMismatchFrame() const;								///< first frame that mismatched during playback, or -1
 	void cleanUpReplayFile( void );										///< after a crash, send replay/debug info to a central repository
 
 	void setArchiveEnabled(Bool enable) { m_archiveReplays = enable; } ///< Enable or disable replay archiving.
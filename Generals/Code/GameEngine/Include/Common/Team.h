@@ -306,7 +306,7 @@ public:
 	/**
 		Set the team as active.  A team is considered created when set active.
 	*/
-	void setActive(void) {if (!m_active) { m_created = true;m_active = true;}}
+	void setActive(void);
 
 	/**
 		Is this team active?
@@ -94,6 +94,7 @@ class UpdateModuleInterface;
 class UpgradeModule;
 class UpgradeModuleInterface;
 class UpgradeTemplate;
+class XferCRC;
 
 class ObjectHeldHelper;
 class ObjectDisabledHelper;
@@ -522,8 +523,8 @@ public:
 	// @todo: inline
 	Bool hasSpecialPower( SpecialPowerType type ) const;
 
-	void setWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition |= (1 << wst); }
-	void clearWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition &= ~(1 << wst); }
+	void setWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition |= (1 << wst); markCRCDirty(); }
+	void clearWeaponBonusCondition(WeaponBonusConditionType wst) { m_weaponBonusCondition &= ~(1 << wst); markCRCDirty(); }
   // note, the !=0 at the end is important, to convert this into a boolean type! (srj)
 	Bool testWeaponBonusCondition(WeaponBonusConditionType wst) const { return (m_weaponBonusCondition & (1 << wst)) != 0; }
 	inline WeaponBonusConditionFlags getWeaponBonusCondition() const { return m_weaponBonusCondition; }
@@ -594,6 +595,11 @@ public:
 
 	Bool isHero() const;
 
+	// TheSuperHackers @performance Incremental logic CRC. The CRC steps of crc() are cached and replayed
+	// until something that crc() reads has changed and the object was marked dirty.
+	void markCRCDirty() const { m_crcStepsValid = FALSE; }
+	void crcIncremental( XferCRC *xfer, Bool validate );
+
 protected:
 
 	void setOrRestoreTeam( Team* team, Bool restoring );
@@ -756,6 +762,8 @@ private:
 
 	UnsignedInt										m_safeOcclusionFrame;	///<flag used by occlusion renderer so it knows when objects have exited their production building.
 
+	std::vector<UnsignedInt>			m_crcSteps;						///< cached CRC steps of crc() for the incremental logic CRC
+
 	// --------- BYTE-SIZED THINGS GO HERE
 	Bool													m_isSelectable;
 	Bool													m_modulesReady;
@@ -767,6 +775,7 @@ private:
 	Byte													m_numTriggerAreasActive;
 	Bool													m_singleUseCommandUsed;
 	Bool													m_isReceivingDifficultyBonus;
+	mutable Bool									m_crcStepsValid;				///< m_crcSteps matches the current state
 
 };
 
@@ -31,6 +31,8 @@
 #include "Common/GameType.h"
 #include "Common/GameMemory.h"
 
+#include <vector>
+
 // forward declaration
 class Object;
 
@@ -152,3 +154,69 @@ public:
 	*/
 	Int getCount() { return m_clumpCount; }
 };
+
+
+//-------------------------------------------------------------------------------------------
+/**
+	TheSuperHackers @performance A stack-friendly alternative to SimpleObjectIterator for
+	range queries. The results live in a small inline buffer and only spill to the heap when
+	a query returns more than INLINE_CAPACITY objects, so unlike SimpleObjectIterator it does
+	not allocate a pooled iterator plus one Clump per object. It is not an ObjectIterator;
+	walk it by index instead:
+
+	ObjectSpan span;
+	ThePartitionManager->collectObjectsInRange(pos, range, FROM_CENTER_2D, span);
+	for (Int i = 0; i < span.getCount(); ++i)
+	{
+		Object *other = span.getObject(i);
+		// do something with other
+	}
+*/
+class ObjectSpan
+{
+public:
+	enum { INLINE_CAPACITY = 32 };
+
+	struct Entry
+	{
+		Object		*m_obj;
+		Real			m_numeric;	// typically, dist-squared
+	};
+
+	ObjectSpan() : m_count(0) { }
+
+	/**
+		throw away all contents of the span. keeps any overflow capacity for reuse.
+	*/
+	void makeEmpty() { m_count = 0; m_overflow.clear(); }
+
+	/**
+		append an object to the span. the numeric value is used only for subsequent
+		sort() calls, just like SimpleObjectIterator::insert().
+	*/
+	void insert(Object *obj, Real numeric = 0.0f);
+
+	/**
+		reverse the order of the contents.
+	*/
+	void reverse();
+
+	/**
+		stable sort of the span using the same orders as SimpleObjectIterator::sort().
+		Note that some orders (ITER_FASTEST) do nothing!
+	*/
+	void sort(IterOrderType order);
+
+	Int getCount() const { return m_count; }
+	Object *getObject(Int i) const { return getEntries()[i].m_obj; }
+	Real getNumeric(Int i) const { return getEntries()[i].m_numeric; }
+
+private:
+
+	Entry *getEntries() { return m_overflow.empty() ? m_inline : &m_overflow[0]; }
+	const Entry *getEntries() const { return m_overflow.empty() ? m_inline : &m_overflow[0]; }
+
+	Entry								m_inline[INLINE_CAPACITY];
+	std::vector<Entry>	m_overflow;	///< holds all entries once m_inline is full
+	Int									m_count;
+};
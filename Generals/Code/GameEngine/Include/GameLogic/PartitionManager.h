@@ -292,7 +292,8 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 {
 private:
 	CellAndObjectIntersection*		m_firstCoiInCell;	///< list of COIs in this cell (may be null).
-	ShroudLevel										m_shroudLevel[MAX_PLAYER_COUNT];
+	ShroudLevel*									m_shroudLevel;		///< shroud of this cell in the plane of player 0, see getShroudLevel
+	Int														m_shroudPlaneSize;	///< distance between the shroud planes of two players
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	Real													m_loTerrainZ;			///< lowest terrain-pt in this cell
 	Real													m_hiTerrainZ;			///< highest terrain-pt in this cell
@@ -314,6 +315,12 @@ public:
 #endif
 	~PartitionCell();
 
+	// TheSuperHackers @performance The shroud is not stored in the cell but in one plane per player,
+	// so revealing a span of cells for a player walks contiguous memory.
+	void initShroud(ShroudLevel *shroudLevel, Int shroudPlaneSize);
+	ShroudLevel &getShroudLevel( Int playerIndex ) { return m_shroudLevel[playerIndex * m_shroudPlaneSize]; }
+	const ShroudLevel &getShroudLevel( Int playerIndex ) const { return m_shroudLevel[playerIndex * m_shroudPlaneSize]; }
+
 	// --------------- inherited from Snapshot interface --------------
 	void crc( Xfer *xfer );
 	void xfer( Xfer *xfer );
@@ -327,7 +334,8 @@ public:
 	void removeLooker( Int playerIndex );
 	void addShrouder( Int playerIndex );
 	void removeShrouder( Int playerIndex );
-	CellShroudStatus getShroudStatusForPlayer( Int playerIndex ) const;
+	CellShroudStatus getShroudStatusForPlayer( Int playerIndex ) const { return getShroudStatus( getShroudLevel( playerIndex ) ); }
+	static CellShroudStatus getShroudStatus( const ShroudLevel &shroudLevel );
 
 	// @todo: All of these are inline candidates
 	UnsignedInt getThreatValue( Int playerIndex );
@@ -358,6 +366,10 @@ public:
 
 	// intended only for CellAndObjectIntersection.
 	void friend_removeFromCellList(CellAndObjectIntersection *coi);
+
+private:
+
+	void onShroudStatusChanged( Int playerIndex, CellShroudStatus newShroud );
 };
 
 //=====================================
@@ -1206,6 +1218,7 @@ private:
 	Int							m_cellCountY;			///< number of cells, y
 	Int							m_totalCellCount;	///< x * y
 	PartitionCell*	m_cells;					///< array of cells
+	ShroudLevel*		m_shroudLevels;		///< MAX_PLAYER_COUNT planes of m_totalCellCount shroud levels, indexed like m_cells
 	PartitionData*	m_dirtyModules;
 	Bool						m_updatedSinceLastReset;	///< Used to force a return of OBJECTSHROUD_INVALID before update has been called.
 
@@ -1229,6 +1242,7 @@ protected:
 		DistanceCalculationType dc,
 		PartitionFilter **filters,
 		SimpleObjectIterator *iter,	// if nonnull, append ALL satisfactory objects to the iterator (not just the single closest)
+		ObjectSpan *span,						// if nonnull, likewise append ALL satisfactory objects to the span
 		Real *closestDistArg,
 		Coord3D *closestVecArg
 	);
@@ -1384,6 +1398,30 @@ public:
 		IterOrderType order = ITER_FASTEST
 	);
 
+	/**
+		TheSuperHackers @performance Same as iterateObjectsInRange, but the results are written to
+		a caller-owned ObjectSpan (usually on the stack) instead of a newly allocated iterator.
+		The span is emptied first, and its contents come out in the same order iterateObjectsInRange
+		would have produced.
+	*/
+	void collectObjectsInRange(
+		const Object *obj,
+		Real maxDist,
+		DistanceCalculationType dc,
+		ObjectSpan &result,
+		PartitionFilter **filters = nullptr,
+		IterOrderType order = ITER_FASTEST
+	);
+
+	void collectObjectsInRange(
+		const Coord3D *pos,
+		Real maxDist,
+		DistanceCalculationType dc,
+		ObjectSpan &result,
+		PartitionFilter **filters = nullptr,
+		IterOrderType order = ITER_FASTEST
+	);
+
 	SimpleObjectIterator *iterateAllObjects(PartitionFilter **filters = nullptr);
 
 	/**
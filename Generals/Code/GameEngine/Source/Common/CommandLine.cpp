@@ -458,6 +458,115 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseReplayResults(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplayResultsFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaysPerJob(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaysPerJob = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaysPerJob < 1)
+		{
+			printf("Invalid number of replays per job: %d\n", TheGlobalData->m_simulateReplaysPerJob);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySnapshots(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySnapshotDir = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySnapshotInterval(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySnapshotInterval = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaySnapshotInterval < 1)
+		{
+			printf("Invalid replay snapshot interval: %d\n", TheGlobalData->m_simulateReplaySnapshotInterval);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySnapshotFrame(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySnapshotFrame = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaySnapshotFrame < 1)
+		{
+			printf("Invalid replay snapshot frame: %d\n", TheGlobalData->m_simulateReplaySnapshotFrame);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parsePoolTelemetry(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_memoryPoolTelemetryFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parsePoolTelemetryInterval(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_memoryPoolTelemetryInterval = atoi(args[1]);
+		if (TheGlobalData->m_memoryPoolTelemetryInterval < 1)
+		{
+			printf("Invalid pool telemetry interval: %d\n", TheGlobalData->m_memoryPoolTelemetryInterval);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseIncrementalCRC(char *args[], int num)
+{
+	TheWritableGlobalData->m_incrementalLogicCRC = TRUE;
+	return 1;
+}
+
+Int parseValidateIncrementalCRC(char *args[], int num)
+{
+	TheWritableGlobalData->m_incrementalLogicCRC = TRUE;
+	TheWritableGlobalData->m_validateIncrementalLogicCRC = TRUE;
+	return 1;
+}
+
+Int parseVerifyScriptSchedule(char *args[], int num)
+{
+	TheWritableGlobalData->m_verifyScriptSchedule = TRUE;
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1163,6 +1272,51 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @feature
+	// Write the result of each simulated replay as one line of JSON to the given file, as soon as
+	// the replay is done: frames, wall time, CRC mismatch frame and peak memory of the worker process.
+	{ "-replayResults", parseReplayResults },
+
+	// TheSuperHackers @performance
+	// With -jobs, let each worker process simulate up to N replays in a row, so the engine startup
+	// is paid once per N replays instead of once per replay. A batch is cut short when the worker's
+	// command line would get too long for the replay paths it holds.
+	{ "-replaysPerJob", parseReplaysPerJob },
+
+	// TheSuperHackers @feature
+	// While simulating replays, keep the logic state of the last 16 snapshot frames in memory and
+	// write them to the given directory when a replay mismatches. Comparing the snapshots of two runs
+	// finds the first -replaySnapshotInterval (default 100) frames in which the game state diverged.
+	// -replaySnapshotFrame stops each replay at the given frame and writes its snapshots even without
+	// a mismatch, so a run of a good build can capture the frames at which another build mismatched.
+	// The snapshot directories of the two runs are compared with the replaysnapshotdiff tool.
+	// The snapshots are for capture and comparison only, the simulation cannot be resumed from them.
+	{ "-replaySnapshots", parseReplaySnapshots },
+	{ "-replaySnapshotInterval", parseReplaySnapshotInterval },
+	{ "-replaySnapshotFrame", parseReplaySnapshotFrame },
+
+	// TheSuperHackers @performance
+	// While simulating replays, write the memory pool counters (used, peak, allocs and frees,
+	// overflow blobs) as CSV to the given file every -poolTelemetryInterval logic frames. The file is
+	// overwritten on each run. Allocs and frees count the whole interval since a pool's previous row,
+	// not a single frame, and pools without any are left out of that report.
+	// With -jobs, each worker writes to the given file name with its first replay number appended.
+	{ "-poolTelemetry", parsePoolTelemetry },
+	{ "-poolTelemetryInterval", parsePoolTelemetryInterval },
+
+	// TheSuperHackers @performance
+	// Cache the logic CRC contribution of every object and recompute it only for objects whose state
+	// was marked dirty since the last CRC frame. The CRC value is the same as without this option.
+	// -validateIncrementalCRC also compares every cached contribution against a full recalculation.
+	{ "-incrementalCRC", parseIncrementalCRC },
+	{ "-validateIncrementalCRC", parseValidateIncrementalCRC },
+
+	// TheSuperHackers @debug
+	// Scripts that only read counters, flags, timers, teams and trigger areas reuse their last condition
+	// result until something they read changes. This option also polls them every time, and reports every
+	// evaluation where the two differ. With -headless -replay, a replay with mismatches counts as failed.
+	{ "-verifyScriptSchedule", parseVerifyScriptSchedule },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
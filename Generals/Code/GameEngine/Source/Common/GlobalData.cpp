@@ -391,6 +391,7 @@ GlobalData* GlobalData::m_theOriginal = nullptr;
 
 	{ "MaxLineBuildObjects",				INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxLineBuildObjects ) },
 	{ "MaxTunnelCapacity",					INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxTunnelCapacity ) },
+	{ "PathfindMaxBudgetScale",			INI::parseInt,				nullptr,			offsetof( GlobalData, m_pathfindMaxBudgetScale ) },
 
 	{ "MaxParticleCount",						INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxParticleCount ) },
 	{ "MaxFieldParticleCount",						INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxFieldParticleCount ) },
@@ -871,6 +872,7 @@ GlobalData::GlobalData()
 	m_commandCenterHealRange = 0.0f;
 	m_commandCenterHealAmount = 0.0f;
 	m_maxTunnelCapacity = 0;
+	m_pathfindMaxBudgetScale = 1;
 	m_maxLineBuildObjects = 0;
 
 	m_standardMinefieldDensity = 0.01f;
@@ -975,6 +977,16 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplayResultsFile.clear();
+	m_simulateReplaysPerJob = 1;
+	m_simulateReplaySnapshotDir.clear();
+	m_simulateReplaySnapshotInterval = 100;
+	m_simulateReplaySnapshotFrame = 0;
+	m_memoryPoolTelemetryFile.clear();
+	m_memoryPoolTelemetryInterval = 10 * LOGICFRAMES_PER_SECOND;
+	m_incrementalLogicCRC = FALSE;
+	m_validateIncrementalLogicCRC = FALSE;
+	m_verifyScriptSchedule = FALSE;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
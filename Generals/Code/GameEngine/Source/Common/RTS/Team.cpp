@@ -1325,6 +1325,7 @@ Team::Team(TeamPrototype *proto, TeamID id ) :
 	if (proto)
 	{
 		proto->prependTo_TeamInstanceList(this);
+		TheScriptEngine->notifyOfTeamChange(this);
 		if (!proto->getTemplateInfo()->m_scriptOnAllClear.isEmpty() ||
 				!proto->getTemplateInfo()->m_scriptOnEnemySighted.isEmpty())
 		{
@@ -1350,6 +1351,7 @@ Team::~Team()
 //	DEBUG_ASSERTCRASH(getFirstItemIn_TeamMemberList() == nullptr, ("Team still has members in existence"));
 
 	TheScriptEngine->notifyOfTeamDestruction(this);
+	TheScriptEngine->notifyOfTeamChange(this);
 
 	// Tell the players a team is going away.
 	Int i;
@@ -1511,6 +1513,17 @@ void Team::setTeamTargetObject(const Object *target)
 	}
 }
 
+// ------------------------------------------------------------------------
+void Team::setActive(void)
+{
+	if (!m_active) {
+		m_created = true;
+		m_active = true;
+		// Scripts find singleton teams only once they are active.
+		TheScriptEngine->notifyOfTeamChange(this);
+	}
+}
+
 // ------------------------------------------------------------------------
 Object *Team::getTeamTargetObject(void)
 {
@@ -601,14 +601,21 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 
 		MessageBoxOk(TheGameText->fetch("GUI:Error"), msg, nullptr);
 
-		// close the file and get out of here
-		xferSave.close();
+		// close the file and get out of here, the save is incomplete so don't write any more of it
+		xferSave.abandon();
 		return SC_ERROR;
 
 	}
 
-	// close the file
-	xferSave.close();
+	// close the file, this writes the last of the buffered save data
+	try {
+		xferSave.close();
+	} catch(...) {
+		// print error message to the user
+		TheInGameUI->message( "GUI:Error" );
+		DEBUG_LOG(( "Error writing file '%s'", filepath.str() ));
+		return SC_ERROR;
+	}
 
 	// print message to the user for game successfully saved
 	UnicodeString msg = TheGameText->fetch( "GUI:GameSaveComplete" );
@@ -1575,11 +1575,62 @@ void clampWaypointPosition( Coord3D &position, Int margin )
 }
 
 
+/**
+ * TheSuperHackers @performance Has the pathfinder build a goal field at pos for each locomotor surface
+ * mask shared by enough ground members, so their own pathfinds to the spots around pos stay cheap.
+ */
+void AIGroup::buildGoalFields( const Coord3D *pos )
+{
+	if (m_memberListSize < PATHFIND_GOAL_FIELD_MIN_MEMBERS)
+		return;
+
+	LocomotorSurfaceTypeMask surfaces[PATHFIND_GOAL_FIELDS];
+	std::vector<Coord3D> starts[PATHFIND_GOAL_FIELDS];
+	Int numSurfaces = 0;
+	Int j;
+	std::list<Object *>::iterator i;
+	for( i = m_memberList.begin(); i != m_memberList.end(); ++i )
+	{
+		Object *obj = (*i);
+		// Crushers search without a field, see Pathfinder::findPath.
+		if (obj->isDisabledByType( DISABLED_HELD ) || obj->isKindOf( KINDOF_AIRCRAFT ) || obj->getCrusherLevel() > 0)
+		{
+			continue;
+		}
+		AIUpdateInterface *ai = obj->getAIUpdateInterface();
+		if (ai==nullptr)
+		{
+			continue;
+		}
+		LocomotorSurfaceTypeMask mask = ai->getLocomotorSet().getValidSurfaces();
+		for (j=0; j<numSurfaces; j++) {
+			if (surfaces[j] == mask) break;
+		}
+		if (j == numSurfaces) {
+			if (numSurfaces == PATHFIND_GOAL_FIELDS) continue;
+			surfaces[numSurfaces++] = mask;
+		}
+		starts[j].push_back(*obj->getPosition());
+	}
+
+	for (j=0; j<numSurfaces; j++) {
+		if (starts[j].size() >= PATHFIND_GOAL_FIELD_MIN_MEMBERS) {
+			TheAI->pathfinder()->buildGoalField(pos, surfaces[j], &starts[j][0], (Int)starts[j].size());
+		}
+	}
+}
+
 /**
  * Move to given position(s)
  */
 void AIGroup::groupMoveToPosition( const Coord3D *pos, Bool addWaypoint, CommandSourceType cmdSource )
 {
+#if !RETAIL_COMPATIBLE_CRC
+	if (!addWaypoint) {
+		buildGoalFields(pos);
+	}
+#endif
+
 	Bool didInfantry = false;
 	Bool didVehicles = false;
 	// compute current centroid of the team
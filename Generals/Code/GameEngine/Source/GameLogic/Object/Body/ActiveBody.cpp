@@ -962,6 +962,8 @@ void ActiveBody::updateBodyParticleSystems( void )
 //-------------------------------------------------------------------------------------------------
 void ActiveBody::internalChangeHealth( Real delta )
 {
+	getObject()->markCRCDirty();
+
 	// save the current health as the previous health
 	m_prevHealth = m_currentHealth;
 
@@ -72,12 +72,14 @@ Bool ExperienceTracker::isTrainable() const
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::setTrainable(Bool trainable)
 {
+	m_parent->markCRCDirty();
 	m_isTrainable = trainable;
 }
 
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::resetTrainable()
 {
+	m_parent->markCRCDirty();
 	m_isTrainable = m_parent->getTemplate()->isTrainable();
 }
 
@@ -103,6 +105,7 @@ ObjectID ExperienceTracker::getExperienceSink() const
 // Set Level to AT LEAST this... if we are already >= this level, do nothing.
 void ExperienceTracker::setMinVeterancyLevel( VeterancyLevel newLevel, Bool provideFeedback )
 {
+	m_parent->markCRCDirty();
 	// This does not check for IsTrainable, because this function is for explicit setting,
 	// so the setter is assumed to know what they are doing.  The game function
 	// of addExperiencePoints cares about Trainability.
@@ -119,6 +122,7 @@ void ExperienceTracker::setMinVeterancyLevel( VeterancyLevel newLevel, Bool prov
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::setVeterancyLevel( VeterancyLevel newLevel, Bool provideFeedback )
 {
+	m_parent->markCRCDirty();
 	// This does not check for IsTrainable, because this function is for explicit setting,
 	// so the setter is assumed to know what they are doing.  The game function
 	// of addExperiencePoints cares about Trainability, if flagged thus.
@@ -161,6 +165,7 @@ Bool ExperienceTracker::canGainExpForLevel(Int levelsToGain) const
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::addExperiencePoints( Int experienceGain, Bool canScaleForBonus)
 {
+	m_parent->markCRCDirty();
 	if( m_experienceSink != INVALID_ID )
 	{
 		// I have been set up to give my experience to someone else
@@ -206,6 +211,7 @@ void ExperienceTracker::addExperiencePoints( Int experienceGain, Bool canScaleFo
 //-------------------------------------------------------------------------------------------------
 void ExperienceTracker::setExperienceAndLevel( Int experienceIn, Bool provideFeedback )
 {
+	m_parent->markCRCDirty();
 	if( m_experienceSink != INVALID_ID )
 	{
 		// I have been set up to give my experience to someone else
@@ -197,7 +197,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
 	m_formationID(NO_FORMATION_ID),
-	m_isReceivingDifficultyBonus(FALSE)
+	m_isReceivingDifficultyBonus(FALSE),
+	m_crcStepsValid(FALSE)
 {
 #if defined(RTS_DEBUG)
 	m_hasDiedAlready = false;
@@ -730,6 +731,7 @@ void Object::setGeometryInfoZ( Real newZ )
 //=============================================================================
 void Object::friend_setUndetectedDefector( Bool status )
 {
+	markCRCDirty();
 	if (status)
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
@@ -796,6 +798,7 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		{
 			m_team->removeFrom_TeamMemberList(this);
 			m_team->getControllingPlayer()->becomingTeamMember(this, false);
+			TheScriptEngine->notifyOfTeamChange(m_team);
 		}
 	}
 
@@ -809,6 +812,7 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		{
 			m_team->prependTo_TeamMemberList(this);
 			m_team->getControllingPlayer()->becomingTeamMember(this, true);
+			TheScriptEngine->notifyOfTeamChange(m_team);
 		}
 
 		// now, adjust the attitude of the unit to its new team.
@@ -1084,6 +1088,7 @@ void Object::topple( const Coord3D *toppleDirection, Real toppleSpeed, UnsignedI
 //=============================================================================
 void Object::reloadAllAmmo(Bool now)
 {
+	markCRCDirty();
 	m_weaponSet.reloadAllAmmo(this, now);
 }
 
@@ -1639,6 +1644,7 @@ void Object::reactToTurretChange( WhichTurretType turret, Real oldRotation, Real
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
 	//USE_PERF_TIMER(Object_reactToTransformChange)
+	markCRCDirty();
 	if(_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
 		TheGameLogic->destroyObject(this);
@@ -1813,6 +1819,10 @@ void Object::healCompletely()
 //-------------------------------------------------------------------------------------------------
 void Object::setEffectivelyDead(Bool dead)
 {
+	markCRCDirty();
+	if (dead != isEffectivelyDead())
+		TheScriptEngine->notifyOfTeamChange(m_team);
+
 	if (dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
@@ -1828,6 +1838,7 @@ void Object::setEffectivelyDead(Bool dead)
 //-------------------------------------------------------------------------------------------------
 void Object::setCaptured(Bool isCaptured)
 {
+	markCRCDirty();
 	if (isCaptured)
 		BitSet(m_privateStatus, CAPTURED);
 	else
@@ -2365,6 +2376,7 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 			if (m_team)
 				m_team->setEnteredExited();
 			TheGameLogic->updateObjectsChangedTriggerAreas();
+			TheScriptEngine->notifyOfTriggerAreaChange(m_triggerInfo[i].pTrigger);
 #ifdef RTS_DEBUG
 			//TheScriptEngine->AppendDebugMessage("Object exited.", false);
 #endif
@@ -2399,6 +2411,7 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 				if (m_team)
 					m_team->setEnteredExited();
 				TheGameLogic->updateObjectsChangedTriggerAreas();
+				TheScriptEngine->notifyOfTriggerAreaChange(pTrig);
 				++m_numTriggerAreasActive;
 #ifdef RTS_DEBUG
 				//TheScriptEngine->AppendDebugMessage("Object entered.", false);
@@ -2558,6 +2571,7 @@ void Object::friend_prepareForMapBoundaryAdjust(void)
 //-------------------------------------------------------------------------------------------------
 void Object::friend_notifyOfNewMapBoundary(void)
 {
+	markCRCDirty();
 	ThePartitionManager->registerObject(this);
 	TheRadar->addObject(this);
 	TheAI->pathfinder()->addObjectToPathfindMap( this );
@@ -2774,6 +2788,7 @@ Bool Object::isMassSelectable() const
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -2785,6 +2800,7 @@ void Object::setWeaponSetFlag(WeaponSetType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst, 0);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -3523,6 +3539,61 @@ void Object::crc( Xfer *xfer )
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Incremental version of crc() for the logic CRC. The CRC steps of the last full crc() are replayed
+	* as long as the object has not been marked dirty. Because every CRC step depends on the previous
+	* one, the cached steps cannot be folded into a single value, but replaying them skips the
+	* traversal of the object, its experience tracker and its weapons.
+	* With 'validate', the cache is compared against a full recalculation. */
+//-------------------------------------------------------------------------------------------------
+void Object::crcIncremental( XferCRC *xfer, Bool validate )
+{
+#ifdef DEBUG_CRC
+	// the object CRC logging happens inside crc(), so do not bypass it
+	if (g_logObjectCRCs)
+	{
+		m_crcStepsValid = FALSE;
+		xfer->xferSnapshot(this);
+		return;
+	}
+#endif // DEBUG_CRC
+
+	if (!m_crcStepsValid)
+	{
+		m_crcSteps.clear();
+		xfer->setStepRecording(&m_crcSteps);
+		xfer->xferSnapshot(this);
+		xfer->setStepRecording(nullptr);
+		m_crcStepsValid = TRUE;
+		return;
+	}
+
+	if (validate)
+	{
+		std::vector<UnsignedInt> steps;
+		steps.reserve(m_crcSteps.size());
+
+		XferCRC validateXfer;
+		validateXfer.open("validateIncrementalCRC");
+		validateXfer.setStepRecording(&steps);
+		validateXfer.xferSnapshot(this);
+		validateXfer.setStepRecording(nullptr);
+		validateXfer.close();
+
+		if (steps != m_crcSteps)
+		{
+			DEBUG_CRASH(("Incremental CRC of object %d (%s) on frame %d is stale, its state changed without markCRCDirty()",
+				m_id, getTemplate()->getName().str(), TheGameLogic->getFrame()));
+			m_crcSteps.swap(steps);
+		}
+	}
+
+	if (!m_crcSteps.empty())
+	{
+		xfer->addCRCSteps(&m_crcSteps[0], (Int)m_crcSteps.size());
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Object xfer implemtation
 	* Version Info:
@@ -3995,6 +4066,7 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 //-------------------------------------------------------------------------------------------------
 void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set( upgradeT->getUpgradeMask() );
@@ -4012,6 +4084,7 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 //-------------------------------------------------------------------------------------------------
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
+	markCRCDirty();
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
 	for (BehaviorModule** module = m_behaviors; *module; ++module)
 	{
@@ -5043,6 +5116,7 @@ void Object::doCommandButtonAtPosition( const CommandButton *commandButton, cons
 // ------------------------------------------------------------------------------------------------
 void Object::clearLeechRangeModeForAllWeapons()
 {
+	markCRCDirty();
 	m_weaponSet.clearLeechRangeModeForAllWeapons();
 }
 
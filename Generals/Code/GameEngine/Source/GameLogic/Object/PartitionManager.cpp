@@ -1223,23 +1223,15 @@ PartitionCell::PartitionCell()
 {
 	m_cellX = m_cellY = 0;
 	m_firstCoiInCell = nullptr;
+	m_shroudLevel = nullptr;
+	m_shroudPlaneSize = 0;
 	m_coiCount = 0;
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	m_loTerrainZ = HUGE_DIST;		// huge positive
 	m_hiTerrainZ = -HUGE_DIST;	// huge negative
 #endif
-	/*
-		You may be asking yourself: why do we model the shroud for all players,
-		rather than just the local player? And the answer is: because this allows
-		us to checksum these values for net games, to help prevent "shroud cheaters"
-		(who use a trainer to disable the shroud on their system).
-	*/
 	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
 	{
-		// Default is "passive shroud".  1,0.
-		m_shroudLevel[i].m_currentShroud = 1;
-		m_shroudLevel[i].m_activeShroudLevel = 0;
-
 		// default cash value is 0
 		m_cashValue[i] = 0;
 
@@ -1255,6 +1247,26 @@ PartitionCell::~PartitionCell()
 	// but don't destroy the Cois; they don't belong to us
 }
 
+//-----------------------------------------------------------------------------
+void PartitionCell::initShroud(ShroudLevel *shroudLevel, Int shroudPlaneSize)
+{
+	m_shroudLevel = shroudLevel;
+	m_shroudPlaneSize = shroudPlaneSize;
+
+	/*
+		You may be asking yourself: why do we model the shroud for all players,
+		rather than just the local player? And the answer is: because this allows
+		us to checksum these values for net games, to help prevent "shroud cheaters"
+		(who use a trainer to disable the shroud on their system).
+	*/
+	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
+	{
+		// Default is "passive shroud".  1,0.
+		getShroudLevel(i).m_currentShroud = 1;
+		getShroudLevel(i).m_activeShroudLevel = 0;
+	}
+}
+
 //-----------------------------------------------------------------------------
 void PartitionCell::invalidateShroudedStatusForAllCois(Int playerIndex)
 {
@@ -1267,95 +1279,68 @@ void PartitionCell::invalidateShroudedStatusForAllCois(Int playerIndex)
 //-----------------------------------------------------------------------------
 void PartitionCell::addLooker(Int playerIndex)
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
+	ShroudLevel &shroudLevel = getShroudLevel( playerIndex );
+	CellShroudStatus oldShroud = getShroudStatus( shroudLevel );
 	// The decreasing Algorithm: A 1 will go straight to -1, otherwise it just gets decremented
-	m_shroudLevel[playerIndex].m_currentShroud = min( m_shroudLevel[playerIndex].m_currentShroud - 1, -1 );
+	shroudLevel.m_currentShroud = min( shroudLevel.m_currentShroud - 1, -1 );
 
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
+	CellShroudStatus newShroud = getShroudStatus( shroudLevel );
 
 //	DEBUG_LOG(( "ADD    %d, %d.  CS = %d, AS = %d for player %d.",
 //							m_cellX,
 //							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
+//							shroudLevel.m_currentShroud,
+//							shroudLevel.m_activeShroudLevel,
 //							playerIndex
 //							));
 
 	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+		onShroudStatusChanged( playerIndex, newShroud );
 }
 
 //-----------------------------------------------------------------------------
 void PartitionCell::removeLooker(Int playerIndex)
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
+	ShroudLevel &shroudLevel = getShroudLevel( playerIndex );
+	CellShroudStatus oldShroud = getShroudStatus( shroudLevel );
 	// the increasing Algorithm: a -1 goes up to min(1,activeLevel), otherwise it just gets incremented
-	if( m_shroudLevel[playerIndex].m_currentShroud == -1 )
-		m_shroudLevel[playerIndex].m_currentShroud = min( m_shroudLevel[playerIndex].m_activeShroudLevel, (Short)1 );
+	if( shroudLevel.m_currentShroud == -1 )
+		shroudLevel.m_currentShroud = min( shroudLevel.m_activeShroudLevel, (Short)1 );
 	else
 	{
-		DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_currentShroud < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
-		m_shroudLevel[playerIndex].m_currentShroud++;
+		DEBUG_ASSERTCRASH( shroudLevel.m_currentShroud < 0, ("Someone is RemoveLooker-ing on a cell that is not looked at.  This will make a permanent shroud blob.") );
+		shroudLevel.m_currentShroud++;
 	}
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
+	CellShroudStatus newShroud = getShroudStatus( shroudLevel );
 
 //	DEBUG_LOG(( "REMOVE %d, %d.  CS = %d, AS = %d for player %d.",
 //							m_cellX,
 //							m_cellY,
-//							m_shroudLevel[playerIndex].m_currentShroud,
-//							m_shroudLevel[playerIndex].m_activeShroudLevel,
+//							shroudLevel.m_currentShroud,
+//							shroudLevel.m_activeShroudLevel,
 //							playerIndex
 //							));
 
 	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+		onShroudStatusChanged( playerIndex, newShroud );
 }
 
 //-----------------------------------------------------------------------------
 void PartitionCell::addShrouder( Int playerIndex )
 {
-	CellShroudStatus oldShroud = getShroudStatusForPlayer( playerIndex );
+	ShroudLevel &shroudLevel = getShroudLevel( playerIndex );
+	CellShroudStatus oldShroud = getShroudStatus( shroudLevel );
 	// Increasing active shroud: activeLevel gets incremented, and CS is set to 1 if at zero
 	// do the algorithm
-	m_shroudLevel[playerIndex].m_activeShroudLevel++;
-	if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
+	shroudLevel.m_activeShroudLevel++;
+	if( shroudLevel.m_currentShroud == 0 )
 	{
-		m_shroudLevel[playerIndex].m_currentShroud = 1;
+		shroudLevel.m_currentShroud = 1;
 	}
-	CellShroudStatus newShroud = getShroudStatusForPlayer( playerIndex );
+	CellShroudStatus newShroud = getShroudStatus( shroudLevel );
 
 	if( oldShroud != newShroud )
-	{
-		// On an edge trigger, tell all objects to think about their shroudedness
-		invalidateShroudedStatusForAllCois( playerIndex );
-
-		// and update the client if we are on the local player
-		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
-		{
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
-		}
-	}
+		onShroudStatusChanged( playerIndex, newShroud );
 }
 
 //-----------------------------------------------------------------------------
@@ -1363,8 +1348,23 @@ void PartitionCell::removeShrouder( Int playerIndex )
 {
 	// Decreasing active shroud: just decrement activeLevel.  This will never result in a client change.
 	// Either it was passive shroud and is now active, or it was being looked at and still is.
-	m_shroudLevel[playerIndex].m_activeShroudLevel--;
-	DEBUG_ASSERTCRASH( m_shroudLevel[playerIndex].m_activeShroudLevel >= 0, ("Shroud generation has gone negative.  This can't happen.") );
+	ShroudLevel &shroudLevel = getShroudLevel( playerIndex );
+	shroudLevel.m_activeShroudLevel--;
+	DEBUG_ASSERTCRASH( shroudLevel.m_activeShroudLevel >= 0, ("Shroud generation has gone negative.  This can't happen.") );
+}
+
+//-----------------------------------------------------------------------------
+void PartitionCell::onShroudStatusChanged( Int playerIndex, CellShroudStatus newShroud )
+{
+	// On an edge trigger, tell all objects to think about their shroudedness
+	invalidateShroudedStatusForAllCois( playerIndex );
+
+	if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
+	{
+		// and if this is the local player, do the Client update.
+		TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
+		TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -1375,13 +1375,13 @@ void PartitionCell::removeShrouder( Int playerIndex )
 //}
 
 //-----------------------------------------------------------------------------
-CellShroudStatus PartitionCell::getShroudStatusForPlayer( Int playerIndex ) const
+CellShroudStatus PartitionCell::getShroudStatus( const ShroudLevel &shroudLevel )
 {
 	// There are now three answers, but the question still requires "to whom"
 
-	if( m_shroudLevel[playerIndex].m_currentShroud == 1 )
+	if( shroudLevel.m_currentShroud == 1 )
 		return CELLSHROUD_SHROUDED;
-	else if( m_shroudLevel[playerIndex].m_currentShroud == 0 )
+	else if( shroudLevel.m_currentShroud == 0 )
 		return CELLSHROUD_FOGGED;// ie Nobody actively looking
 	else
 		return CELLSHROUD_CLEAR;
@@ -1501,7 +1501,12 @@ void PartitionCell::validateCoiList()
 void PartitionCell::crc( Xfer *xfer )
 {
 
-	xfer->xferUser(&m_shroudLevel, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
+	// gather the shroud of all players, so the CRC is the same as when it was stored in the cell
+	ShroudLevel shroudLevel[MAX_PLAYER_COUNT];
+	for (Int i = 0; i < MAX_PLAYER_COUNT; ++i)
+		shroudLevel[i] = getShroudLevel(i);
+
+	xfer->xferUser(shroudLevel, sizeof(ShroudLevel) * MAX_PLAYER_COUNT);
 	xfer->xferUser(&m_cellX, sizeof(m_cellX));
 	xfer->xferUser(&m_cellY, sizeof(m_cellY));
 
@@ -1518,8 +1523,18 @@ void PartitionCell::xfer( Xfer *xfer )
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
-	// xfer shroud data
-	xfer->xferUser( &m_shroudLevel, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+	// xfer shroud data, in the same layout as when it was stored in the cell
+	ShroudLevel shroudLevel[ MAX_PLAYER_COUNT ];
+	for( Int i = 0; i < MAX_PLAYER_COUNT; ++i )
+		shroudLevel[ i ] = getShroudLevel( i );
+
+	xfer->xferUser( shroudLevel, sizeof( ShroudLevel ) * MAX_PLAYER_COUNT );
+
+	if( xfer->getXferMode() == XFER_LOAD )
+	{
+		for( Int i = 0; i < MAX_PLAYER_COUNT; ++i )
+			getShroudLevel( i ) = shroudLevel[ i ];
+	}
 
 }
 
@@ -2566,6 +2581,7 @@ PartitionManager::PartitionManager()
 	m_cellCountY = 0;
 	m_totalCellCount = 0;
 	m_cells = nullptr;
+	m_shroudLevels = nullptr;
 	m_worldExtents.lo.zero();
 	m_worldExtents.hi.zero();
 	m_dirtyModules = nullptr;
@@ -2633,6 +2649,11 @@ void PartitionManager::init()
 		m_cellCountY = REAL_TO_INT_CEIL(m_worldExtents.height() * m_cellSizeInv);
 		m_totalCellCount = m_cellCountX * m_cellCountY;
 		m_cells = MSGNEW("PartitionManager_Cells") PartitionCell[m_totalCellCount];
+		m_shroudLevels = MSGNEW("PartitionManager_ShroudLevels") ShroudLevel[MAX_PLAYER_COUNT * m_totalCellCount];
+		for (Int i = 0; i < m_totalCellCount; ++i)
+		{
+			m_cells[i].initShroud(&m_shroudLevels[i], m_totalCellCount);
+		}
 		for (Int x = 0; x < m_cellCountX; x++)
 		{
 			for (Int y = 0; y < m_cellCountY; y++)
@@ -2721,6 +2742,8 @@ void PartitionManager::shutdown()
 
 	delete [] m_cells;
 	m_cells = nullptr;
+	delete [] m_shroudLevels;
+	m_shroudLevels = nullptr;
 
 	m_cellSize = m_cellSizeInv = 0.0f;
 	m_cellCountX = 0;
@@ -3050,13 +3073,14 @@ void PartitionManager::refreshShroudForLocalPlayer()
 	if (m_totalCellCount != 0)
 	{
 		const Int playerIndex = rts::getObservedOrLocalPlayer()->getPlayerIndex();
+		const ShroudLevel *shroudPlane = &m_shroudLevels[playerIndex * m_totalCellCount];
 		TheRadar->beginSetShroudLevel();
 
 		for (int i = 0; i < m_totalCellCount; ++i)
 		{
 			const Int x = m_cells[i].getCellX();
 			const Int y = m_cells[i].getCellY();
-			const CellShroudStatus status = m_cells[i].getShroudStatusForPlayer(playerIndex);
+			const CellShroudStatus status = PartitionCell::getShroudStatus(shroudPlane[i]);
 			TheDisplay->setShroudLevel(x, y, status);
 			TheRadar->setShroudLevel(x, y, status);
 			m_cells[i].invalidateShroudedStatusForAllCois(playerIndex);
@@ -3228,6 +3252,7 @@ Object *PartitionManager::getClosestObjects(
 	DistanceCalculationType dc,
 	PartitionFilter **filters,
 	SimpleObjectIterator *iterArg,	// if nonnull, append ALL satisfactory objects to the iterator (not just the single closest)
+	ObjectSpan *spanArg,					// if nonnull, likewise append ALL satisfactory objects to the span
 	Real *closestDistArg,
 	Coord3D *closestVecArg
 )
@@ -3350,6 +3375,10 @@ Object *PartitionManager::getClosestObjects(
 				{
 					iterArg->insert(thisObj, thisDistSqr);
 				}
+				else if (spanArg)
+				{
+					spanArg->insert(thisObj, thisDistSqr);
+				}
 				else
 				{
 					// hey, this is the new closest object! cool.
@@ -3425,6 +3454,10 @@ Object *PartitionManager::getClosestObjects(
 			{
 				iterArg->insert(thisObj, thisDistSqr);
 			}
+			else if (spanArg)
+			{
+				spanArg->insert(thisObj, thisDistSqr);
+			}
 			else
 			{
 				closestObj = thisObj;
@@ -3481,7 +3514,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
-	return getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
+	return getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, nullptr, closestDist, closestDistVec);
 }
 
 //-----------------------------------------------------------------------------
@@ -3494,7 +3527,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
-	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
+	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, nullptr, closestDist, closestDistVec);
 }
 
 //-----------------------------------------------------------------------------
@@ -3631,7 +3664,7 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
 
-	getClosestObjects(obj, nullptr, maxDist, dc, filters, iter, nullptr, nullptr);
+	getClosestObjects(obj, nullptr, maxDist, dc, filters, iter, nullptr, nullptr, nullptr);
 
 	iter->sort(order);
 	iterHolder.release();
@@ -3651,13 +3684,53 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
 
-	getClosestObjects(nullptr, pos, maxDist, dc, filters, iter, nullptr, nullptr);
+	getClosestObjects(nullptr, pos, maxDist, dc, filters, iter, nullptr, nullptr, nullptr);
 
 	iter->sort(order);
 	iterHolder.release();
 	return iter;
 }
 
+//-----------------------------------------------------------------------------
+void PartitionManager::collectObjectsInRange(
+	const Object *obj,
+	Real maxDist,
+	DistanceCalculationType dc,
+	ObjectSpan &result,
+	PartitionFilter **filters,
+	IterOrderType order
+)
+{
+	result.makeEmpty();
+
+	getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, &result, nullptr, nullptr);
+
+	// SimpleObjectIterator inserts at its head, so reverse to hand out the objects in the
+	// exact same order. The logic depends on it for CRC-identical behavior.
+	result.reverse();
+	result.sort(order);
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::collectObjectsInRange(
+	const Coord3D *pos,
+	Real maxDist,
+	DistanceCalculationType dc,
+	ObjectSpan &result,
+	PartitionFilter **filters,
+	IterOrderType order
+)
+{
+	result.makeEmpty();
+
+	getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, &result, nullptr, nullptr);
+
+	// SimpleObjectIterator inserts at its head, so reverse to hand out the objects in the
+	// exact same order. The logic depends on it for CRC-identical behavior.
+	result.reverse();
+	result.sort(order);
+}
+
 //-----------------------------------------------------------------------------
 SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
 	const Coord3D* pos,
@@ -3676,7 +3749,7 @@ SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
 	PartitionFilterWouldCollide filter(*pos, geom, angle, true);
 	PartitionFilter *filters[] = { &filter, nullptr };
 
-	getClosestObjects(nullptr, pos, maxDist, use2D ? FROM_BOUNDINGSPHERE_2D : FROM_BOUNDINGSPHERE_3D, filters, iter, nullptr, nullptr);
+	getClosestObjects(nullptr, pos, maxDist, use2D ? FROM_BOUNDINGSPHERE_2D : FROM_BOUNDINGSPHERE_3D, filters, iter, nullptr, nullptr, nullptr);
 
 	iterHolder.release();
 	return iter;
@@ -5585,71 +5658,102 @@ static int cellValueProc(PartitionCell* cell, void* userData)
 	return 0;
 }
 
+// -----------------------------------------------------------------------------
+// TheSuperHackers @performance The shroud span functions clip the span once and then walk the
+// contiguous shroud plane of the player. Only the cells that change their shroud status go through
+// the PartitionCell functions, all other cells just update their counters.
+// -----------------------------------------------------------------------------
+static Bool clipShroudSpan(Int &x1, Int &x2, Int y, Int cellCountX, Int cellCountY)
+{
+	if (y < 0 || y >= cellCountY || x1 >= cellCountX || x2 < 0)
+		return false;
+
+	if (x1 < 0)
+		x1 = 0;
+	if (x2 >= cellCountX)
+		x2 = cellCountX - 1;
+
+	return true;
+}
+
 // -----------------------------------------------------------------------------
 static void hLineAddLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 {
-	if (y < 0 || y >= ThePartitionManager->m_cellCountY || x1 >= ThePartitionManager->m_cellCountX || x2 < 0)
+	if (!clipShroudSpan(x1, x2, y, ThePartitionManager->m_cellCountX, ThePartitionManager->m_cellCountY))
 		return;
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
+	const Int cellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	PartitionCell* cell = &ThePartitionManager->m_cells[cellIndex];
+	ShroudLevel* shroudLevel = &ThePartitionManager->m_shroudLevels[playerIndex * ThePartitionManager->m_totalCellCount + cellIndex];
+	for (Int x = x1; x <= x2; ++x, ++cell, ++shroudLevel)
 	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->addLooker(playerIndex);
+		// a cell that is already looked at stays clear, it only counts one more looker
+		if (shroudLevel->m_currentShroud < 0)
+			--shroudLevel->m_currentShroud;
+		else
+			cell->addLooker(playerIndex);
 	}
 }
 
 // -----------------------------------------------------------------------------
 static void hLineRemoveLooker(Int x1, Int x2, Int y, void *playerIndexVoid)
 {
-	if (y < 0 || y >= ThePartitionManager->m_cellCountY || x1 >= ThePartitionManager->m_cellCountX || x2 < 0)
+	if (!clipShroudSpan(x1, x2, y, ThePartitionManager->m_cellCountX, ThePartitionManager->m_cellCountY))
 		return;
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
+	const Int cellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	PartitionCell* cell = &ThePartitionManager->m_cells[cellIndex];
+	ShroudLevel* shroudLevel = &ThePartitionManager->m_shroudLevels[playerIndex * ThePartitionManager->m_totalCellCount + cellIndex];
+	for (Int x = x1; x <= x2; ++x, ++cell, ++shroudLevel)
 	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->removeLooker(playerIndex);
+		// a cell with other lookers left stays clear
+		if (shroudLevel->m_currentShroud < -1)
+			++shroudLevel->m_currentShroud;
+		else
+			cell->removeLooker(playerIndex);
 	}
 }
 
 // -----------------------------------------------------------------------------
 static void hLineAddShrouder(Int x1, Int x2, Int y, void *playerIndexVoid)
 {
-	if (y < 0 || y >= ThePartitionManager->m_cellCountY || x1 >= ThePartitionManager->m_cellCountX || x2 < 0)
+	if (!clipShroudSpan(x1, x2, y, ThePartitionManager->m_cellCountX, ThePartitionManager->m_cellCountY))
 		return;
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
+	const Int cellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	PartitionCell* cell = &ThePartitionManager->m_cells[cellIndex];
+	ShroudLevel* shroudLevel = &ThePartitionManager->m_shroudLevels[playerIndex * ThePartitionManager->m_totalCellCount + cellIndex];
+	for (Int x = x1; x <= x2; ++x, ++cell, ++shroudLevel)
 	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->addShrouder( playerIndex );
+		// only a fogged cell becomes shrouded
+		if (shroudLevel->m_currentShroud != 0)
+			++shroudLevel->m_activeShroudLevel;
+		else
+			cell->addShrouder( playerIndex );
 	}
 }
 
 // -----------------------------------------------------------------------------
 static void hLineRemoveShrouder(Int x1, Int x2, Int y, void *playerIndexVoid)
 {
-	if (y < 0 || y >= ThePartitionManager->m_cellCountY || x1 >= ThePartitionManager->m_cellCountX || x2 < 0)
+	if (!clipShroudSpan(x1, x2, y, ThePartitionManager->m_cellCountX, ThePartitionManager->m_cellCountY))
 		return;
 
 	Int playerIndex = (Int)(playerIndexVoid);
 
-	PartitionCell* cell = &ThePartitionManager->m_cells[y * ThePartitionManager->m_cellCountX + x1];	// yes, this could be invalid. we'll skip the bad ones.
-	for (Int x = x1; x <= x2; ++x, ++cell)
+	// removing a shrouder never changes the shroud status of a cell
+	const Int cellIndex = y * ThePartitionManager->m_cellCountX + x1;
+	ShroudLevel* shroudLevel = &ThePartitionManager->m_shroudLevels[playerIndex * ThePartitionManager->m_totalCellCount + cellIndex];
+	for (Int x = x1; x <= x2; ++x, ++shroudLevel)
 	{
-		if (x < 0 || x >= ThePartitionManager->m_cellCountX)
-			continue;
-		cell->removeShrouder( playerIndex );
+		--shroudLevel->m_activeShroudLevel;
+		DEBUG_ASSERTCRASH( shroudLevel->m_activeShroudLevel >= 0, ("Shroud generation has gone negative.  This can't happen.") );
 	}
 }
 
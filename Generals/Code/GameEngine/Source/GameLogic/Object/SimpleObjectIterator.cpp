@@ -32,6 +32,8 @@
 #include "Common/ThingTemplate.h"
 #include "GameLogic/Object.h"
 
+#include <algorithm>
+
 
 /// @todo Doxygenize this file
 
@@ -271,3 +273,101 @@ Real SimpleObjectIterator::sortExpensiveToCheap(Clump *a, Clump *b)
 				 a->m_obj->getTemplate()->friend_getBuildCost();
 }
 
+//=============================================================================
+// TheSuperHackers @performance ObjectSpan
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Returns <= 0 when a may stay in front of b, matching the SimpleObjectIterator sort procs.
+static Real compareSpanEntries(IterOrderType order, const ObjectSpan::Entry &a, const ObjectSpan::Entry &b)
+{
+	switch (order)
+	{
+		case ITER_SORTED_NEAR_TO_FAR:
+			return a.m_numeric - b.m_numeric;
+		case ITER_SORTED_FAR_TO_NEAR:
+			return b.m_numeric - a.m_numeric;
+		case ITER_SORTED_CHEAP_TO_EXPENSIVE:
+			return a.m_obj->getTemplate()->friend_getBuildCost() - b.m_obj->getTemplate()->friend_getBuildCost();
+		case ITER_SORTED_EXPENSIVE_TO_CHEAP:
+			return b.m_obj->getTemplate()->friend_getBuildCost() - a.m_obj->getTemplate()->friend_getBuildCost();
+		default:
+			return 0.0f;
+	}
+}
+
+//-----------------------------------------------------------------------------
+struct SpanEntryLess
+{
+	IterOrderType m_order;
+
+	SpanEntryLess(IterOrderType order) : m_order(order) { }
+
+	bool operator()(const ObjectSpan::Entry &a, const ObjectSpan::Entry &b) const
+	{
+		return compareSpanEntries(m_order, a, b) < 0.0f;
+	}
+};
+
+//=============================================================================
+void ObjectSpan::insert(Object *obj, Real numeric)
+{
+	DEBUG_ASSERTCRASH(obj, ("sorry, no nulls allowed here"));
+
+	Entry entry;
+	entry.m_obj = obj;
+	entry.m_numeric = numeric;
+
+	if (m_overflow.empty())
+	{
+		if (m_count < INLINE_CAPACITY)
+		{
+			m_inline[m_count++] = entry;
+			return;
+		}
+
+		// out of inline room; move everything to the heap and stay there until makeEmpty().
+		m_overflow.reserve(INLINE_CAPACITY * 2);
+		m_overflow.assign(m_inline, m_inline + m_count);
+	}
+
+	m_overflow.push_back(entry);
+	++m_count;
+}
+
+//=============================================================================
+void ObjectSpan::reverse()
+{
+	Entry *entries = getEntries();
+	std::reverse(entries, entries + m_count);
+}
+
+//=============================================================================
+void ObjectSpan::sort(IterOrderType order)
+{
+	if (m_count < 2 || order == ITER_FASTEST)
+		return;
+
+	// Both paths are stable, so equal keys keep their relative order exactly as the
+	// SimpleObjectIterator mergesort would leave them.
+	if (m_overflow.empty())
+	{
+		// small inline spans: insertion sort, which needs no scratch memory.
+		Entry *entries = m_inline;
+		for (Int i = 1; i < m_count; ++i)
+		{
+			Entry cur = entries[i];
+			Int j = i;
+			while (j > 0 && compareSpanEntries(order, entries[j - 1], cur) > 0.0f)
+			{
+				entries[j] = entries[j - 1];
+				--j;
+			}
+			entries[j] = cur;
+		}
+	}
+	else
+	{
+		std::stable_sort(m_overflow.begin(), m_overflow.end(), SpanEntryLess(order));
+	}
+}
@@ -1272,9 +1272,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 	DeathType deathType = getDeathType();
 	if (getProjectileTemplate() == nullptr || isProjectileDetonation)
 	{
-		SimpleObjectIterator *iter;
-		Object *curVictim;
-		Real curVictimDistSqr;
+		// TheSuperHackers @performance Collect the victims into a stack span instead of a pooled iterator.
+		ObjectSpan victims;
 
 		Real primaryRadius = getPrimaryDamageRadius(bonus);
 		Real secondaryRadius = getSecondaryDamageRadius(bonus);
@@ -1288,8 +1287,7 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		Real radius = max(primaryRadius, secondaryRadius);
 		if (radius > 0.0f)
 		{
-			iter = ThePartitionManager->iterateObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE);
-			curVictim = iter->firstWithNumeric(&curVictimDistSqr);
+			ThePartitionManager->collectObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE, victims);
 		}
 		else
 		{
@@ -1297,14 +1295,15 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 			// check against victimID rather than primaryVictim, since we may have targeted a legitimate victim
 			// that got killed before the damage was dealt... (srj)
 			//DEBUG_ASSERTCRASH(victimID != 0, ("weapons without radii should always pass in specific victims"));
-			iter = nullptr;
-			curVictim = primaryVictim;
-			curVictimDistSqr = 0.0f;
+			if (primaryVictim != nullptr)
+				victims.insert(primaryVictim, 0.0f);
 		}
-		MemoryPoolObjectHolder hold(iter);
 
-		for (; curVictim != nullptr; curVictim = iter ? iter->nextWithNumeric(&curVictimDistSqr) : nullptr)
+		for (Int victimIndex = 0; victimIndex < victims.getCount(); ++victimIndex)
 		{
+			Object *curVictim = victims.getObject(victimIndex);
+			Real curVictimDistSqr = victims.getNumeric(victimIndex);
+
 			Bool killSelf = false;
 			if (source != nullptr)
 			{
@@ -1819,6 +1818,9 @@ void Weapon::rebuildScatterTargets()
 //-------------------------------------------------------------------------------------------------
 void Weapon::reloadWithBonus(const Object *sourceObj, const WeaponBonus& bonus, Bool loadInstantly)
 {
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	if (m_template->getClipSize() > 0
 			&& m_ammoInClip == m_template->getClipSize()
 			&& !sourceObj->isReloadTimeShared())
@@ -2288,6 +2290,9 @@ Real Weapon::estimateWeaponDamage(const Object *sourceObj, const Object *victimO
 //-------------------------------------------------------------------------------------------------
 void Weapon::newProjectileFired(const Object *sourceObj, const Object *projectile )
 {
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	// If I have a stream, I need to tell it about this new guy
 	if( m_template->getProjectileStreamName().isEmpty() )
 		return; // nope, no streak logic to do
@@ -2361,6 +2366,9 @@ Bool Weapon::privateFireWeapon(
 	if (projectileID)
 		*projectileID = INVALID_ID;
 
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	if (!m_template)
 		return false;
 
@@ -2564,6 +2572,9 @@ Bool Weapon::privateFireWeapon(
 //-------------------------------------------------------------------------------------------------
 void Weapon::preFireWeapon( const Object *source, const Object *victim )
 {
+	if (source)
+		source->markCRCDirty();
+
 	Int delay = getPreAttackDelay( source, victim );
 	if( delay > 0 )
 	{
@@ -340,17 +340,29 @@ public:
 	Real m_commandCenterHealAmount;   ///< health per logic frame close by things are healed
 	Int m_maxLineBuildObjects;				///< line style builds can be no longer than this
 	Int m_maxTunnelCapacity;					///< Max people in Player's tunnel network
+	Int m_pathfindMaxBudgetScale;			///< TheSuperHackers @performance Most multiples of the pathfind cell budget a long pathfind queue may search per frame, 1 keeps the original budget
 	Real m_horizontalScrollSpeedFactor;	///< Factor applied to the game screen scrolling speed.
 	Real m_verticalScrollSpeedFactor;		///< Separated because of our aspect ratio
 	Real m_scrollAmountCutoff;				///< Scroll speed to not adjust camera height
 	Real m_cameraAdjustSpeed;					///< Rate at which we adjust camera height
 	Bool m_enforceMaxCameraHeight;		///< Enforce max camera height while scrolling?
 	Bool m_buildMapCache;
+	Bool m_useINICache;								///< TheSuperHackers @performance Load and refresh the pre-tokenized INI cache, see INICache
 	AsciiString m_initialFile;				///< If this is specified, load a specific map from the command-line
 	AsciiString m_pendingFile;				///< If this is specified, use this map at the next game start
 
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	AsciiString m_simulateReplayResultsFile; ///< If not empty, write one JSON line per simulated replay to this file
+	Int m_simulateReplaysPerJob; ///< Number of replays each worker process simulates before it exits
+	AsciiString m_simulateReplaySnapshotDir; ///< If not empty, keep logic snapshots in memory while simulating replays and write them here on a mismatch
+	Int m_simulateReplaySnapshotInterval; ///< Number of logic frames between two replay logic snapshots
+	Int m_simulateReplaySnapshotFrame; ///< If not 0, stop each replay at this logic frame and write its snapshots
+	AsciiString m_memoryPoolTelemetryFile; ///< If not empty, write memory pool counters as CSV to this file while simulating replays, overwriting it
+	Int m_memoryPoolTelemetryInterval; ///< Number of logic frames between two memory pool telemetry reports, the allocs and frees are counted per interval
+	Bool m_incrementalLogicCRC; ///< Cache the CRC steps of each object and recompute them only for objects marked dirty
+	Bool m_validateIncrementalLogicCRC; ///< Compare the cached object CRC steps against a full recalculation
+	Bool m_verifyScriptSchedule; ///< Also poll the scheduled scripts whose result is reused, and count where the results differ
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
@@ -184,6 +184,9 @@ public:
 	// Throws if the INI file is not found or is not read correctly.
 	UnsignedInt load( AsciiString filename, INILoadType loadType, Xfer *pXfer );
 
+	// TheSuperHackers @performance Read one INI file into TheINICache without parsing it.
+	UnsignedInt cacheFile( AsciiString filename );
+
 	static Bool isDeclarationOfType( AsciiString blockType, AsciiString blockName, char *bufferToCheck );
 	static Bool isEndOfBlock( char *bufferToCheck );
 
@@ -433,6 +436,13 @@ protected:
 	const char *m_sepsQuote;									///< token to represent a quoted ascii string
 	const char *m_blockEndToken;							///< token to represent end of data block
 	Bool m_endOfFile;													///< TRUE when we've hit EOF
+
+	// TheSuperHackers @performance Lines served from or recorded for TheINICache
+	const char *m_cachedLineNext;							///< next line to serve from TheINICache, null when reading m_file
+	const char *m_cachedLineEnd;							///< end of the cached lines
+	Bool m_recordLines;												///< TRUE when lines read from m_file are kept for TheINICache
+	std::vector<char> m_recordedLines;				///< null terminated lines read from m_file so far
+	UnsignedInt m_recordedLineCount;					///< number of lines in m_recordedLines
 #ifdef DEBUG_CRASHING
 	char m_curBlockStart[ INI_MAX_CHARS_PER_LINE+1 ];	///< first line of cur block
 #endif
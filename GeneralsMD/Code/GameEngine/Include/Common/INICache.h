@@ -0,0 +1,78 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: INICache.h ///////////////////////////////////////////////////////////////////////////////
+// Desc:   Pre-tokenized cache of the INI files under Data\INI
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common/AsciiString.h"
+#include "Common/STLTypedefs.h"
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Stores the lines INI::readLine produces for each INI file, with
+	* comments already stripped and whitespace already folded. INI::load serves a cached file from
+	* here instead of scanning its text, and still feeds every line to the INI CRC Xfer, so the INI
+	* CRC stays the same.
+	*
+	* An entry is keyed by the file path and validated against the size and timestamp that
+	* TheFileSystem reports for it. For files inside a .big archive that is the archive timestamp,
+	* so editing a loose INI file or replacing any .big file invalidates the affected entries. */
+//-------------------------------------------------------------------------------------------------
+class INICache
+{
+public:
+
+	struct Entry
+	{
+		Int sizeHigh;
+		Int sizeLow;
+		Int timestampHigh;
+		Int timestampLow;
+		UnsignedInt lineCount;
+		std::vector<char> lines;		///< lineCount null terminated lines, back to back
+	};
+
+	INICache();
+
+	static const char* getDefaultFilename() { return "Data\\INI\\INICache.bin"; }
+
+	/// Only files under Data\INI are cached
+	static Bool isCacheable( const AsciiString& filename );
+
+	Bool load( const char* cacheFilename );					///< read a cache file written by save(), returns FALSE if missing or stale
+	Bool save( const char* cacheFilename );					///< write all entries, returns FALSE on failure
+
+	const Entry* find( const AsciiString& filename ) const;		///< return the entry if it is still valid for the file on disk
+	void store( const AsciiString& filename, const std::vector<char>& lines, UnsignedInt lineCount );
+
+	Bool isDirty() const { return m_dirty; }
+	UnsignedInt getEntryCount() const { return (UnsignedInt)m_entries.size(); }
+
+private:
+
+	typedef std::hash_map< AsciiString, Entry, rts::hash<AsciiString>, rts::equal_to<AsciiString> > EntryMap;
+
+	static AsciiString makeKey( const AsciiString& filename );
+
+	EntryMap m_entries;
+	Bool m_dirty;
+};
+
+extern INICache *TheINICache;
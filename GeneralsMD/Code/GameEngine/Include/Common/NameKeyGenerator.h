@@ -34,6 +34,7 @@
 #include "Common/SubsystemInterface.h"
 #include "Common/GameMemory.h"
 #include "Common/AsciiString.h"
+#include "Common/STLTypedefs.h"
 
 //-------------------------------------------------------------------------------------------------
 // Note that NameKeyType isn't a "real" enum, but an enum type used to enforce the
@@ -98,9 +99,10 @@ public:
 	NameKeyType nameToLowercaseKey(const char *name);
 
 	// given a key, return the name. this is almost never needed,
-	// except for a few rare cases like object serialization. also
-	// note that it's not particularly fast; it does a dumb linear
-	// search for the key.
+	// except for a few rare cases like object serialization, debug
+	// output and CRC logging.
+	// TheSuperHackers @performance This is an index into m_keyBuckets now instead of a linear
+	// search through all sockets, and it is safe to call from threads other than the main thread.
 	AsciiString keyToName(NameKeyType key);
 
 	// Get a string out of the INI. Store it into a NameKeyType
@@ -126,7 +128,10 @@ private:
 
 	void freeSockets();
 
+	typedef std::vector<Bucket*> BucketVector;
+
 	Bucket*				m_sockets[SOCKET_COUNT];			///< Catalog of all Buckets already generated
+	BucketVector	m_keyBuckets;									///< All Buckets already generated, indexed by key
 	UnsignedInt		m_nextID;											///< Next available ID
 
 };
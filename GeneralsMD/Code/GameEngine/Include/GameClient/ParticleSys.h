@@ -152,6 +152,8 @@ protected:
 };
 
 
+struct ParticleUpdateInfo;
+
 /**
  * An individual particle created by a ParticleSystem.
  * NOTE: Particles cannot exist without a parent particle system.
@@ -166,8 +168,8 @@ public:
 
 	Particle( ParticleSystem *system, const ParticleInfo *data );
 
-	inline Bool update( void );												///< update this particle's behavior - return false if dead
-	void doWindMotion( void );									///< do wind motion (if present) from particle system
+	inline Bool update( const ParticleUpdateInfo &info );	///< update this particle's behavior - return false if dead
+	inline void doWindMotion( const ParticleUpdateInfo &info );	///< do wind motion (if present) from particle system
 
 	void applyForce( const Coord3D *force );		///< add the given acceleration
 
@@ -178,7 +180,7 @@ public:
 	const RGBColor *getColor( void ) { return &m_color; }
 	void setColor( RGBColor *color ) { m_color = *color; }
 
-	inline Bool isInvisible( void );										///< return true if this particle is invisible
+	Bool isInvisible( void );														///< return true if this particle is invisible
 	Bool isCulled (void) {return m_isCulled;}				///< return true if the particle falls off the edge of the screen
 	void setIsCulled (Bool enable) { m_isCulled = enable;}		///< set particle to not visible because it's outside view frustum
 
@@ -201,6 +203,8 @@ protected:
 	void computeAlphaRate( void );							///< compute alpha rate to get to next key
 	void computeColorRate( void );							///< compute color change to get to next key
 
+	inline Bool isInvisible( Int shaderType );	///< return true if this particle is invisible with the given ParticleShaderType
+
 public:
 	Particle *				m_systemNext;
 	Particle *				m_systemPrev;
@@ -558,6 +562,7 @@ public:
 
 	virtual Bool update( Int localPlayerIndex );								///< update this particle system, return false if dead
 	void updateWindMotion( void );							///< update wind motion
+	void computeWindOrigin( Coord3D *origin );	///< world position the wind force is measured from
 
 	void setControlParticle( Particle *p );			///< set control particle
 
@@ -639,6 +644,13 @@ public:
 	Real getWindAngle( void ) { return m_windAngle; }
 	WindMotion getWindMotion( void ) { return m_windMotion; }
 
+	/// next system in the manager's list of all particle systems
+	ParticleSystem *getNextParticleSystem( void ) { return m_allSystemsNext; }
+
+public:
+	ParticleSystem *	m_allSystemsNext;									///< only for use by ParticleSystemManager
+	ParticleSystem *	m_allSystemsPrev;									///< only for use by ParticleSystemManager
+
 protected:
 
 	// snapshot methods
@@ -721,9 +733,8 @@ class ParticleSystemManager : public SubsystemInterface,
 
 public:
 
-	typedef std::list<ParticleSystem*> ParticleSystemList;
-	typedef std::list<ParticleSystem*>::iterator ParticleSystemListIt;
 	typedef std::hash_map<AsciiString, ParticleSystemTemplate *, rts::hash<AsciiString>, rts::equal_to<AsciiString> > TemplateMap;
+	typedef std::hash_map<UnsignedInt, ParticleSystem *, rts::hash<UnsignedInt>, rts::equal_to<UnsignedInt> > ParticleSystemIDMap;
 
 	ParticleSystemManager( void );
 	virtual ~ParticleSystemManager();
@@ -774,10 +785,14 @@ public:
 
 	UnsignedInt getFieldParticleCount( void )     const { return m_fieldParticleCount; }
 
+#ifdef DUMP_PERF_STATS
+	void getUpdateStats( UnsignedInt& particlesUpdatedThisFrame, double& updateTimeThisFrame );	///< particles updated and msecs spent in the last update
+#endif
+
 	UnsignedInt getParticleSystemCount( void ) const { return m_particleSystemCount; }
 
-	// @todo const this jkmcd
-	ParticleSystemList &getAllParticleSystems( void ) { return m_allParticleSystemList; }
+	/// first of all particle systems, use ParticleSystem::getNextParticleSystem to iterate the rest
+	ParticleSystem *getFirstParticleSystem( void ) { return m_allParticleSystemsHead; }
 
 	virtual void doParticles(RenderInfoClass &rinfo) = 0;
 	virtual void queueParticleRender() = 0;
@@ -787,6 +802,7 @@ public:
 	// these are only for use by partcle systems to link and unlink themselves
 	void friend_addParticleSystem( ParticleSystem *particleSystemToAdd );
 	void friend_removeParticleSystem( ParticleSystem *particleSystemToRemove );
+	void friend_changeParticleSystemID( ParticleSystem *particleSystem, ParticleSystemID oldID );
 
 protected:
 
@@ -800,7 +816,11 @@ protected:
 
 	ParticleSystemID m_uniqueSystemID;					///< unique system ID to assign to each system created
 
-	ParticleSystemList m_allParticleSystemList;
+	// TheSuperHackers @performance All systems are kept in an intrusive list, so adding and removing
+	// one does not allocate or search, and are indexed by ID for findParticleSystem.
+	ParticleSystem *m_allParticleSystemsHead;
+	ParticleSystem *m_allParticleSystemsTail;
+	ParticleSystemIDMap m_particleSystemIDMap;
 
 	UnsignedInt m_particleCount;
 	UnsignedInt m_fieldParticleCount; ///< this does not need to be xfered, since it is evaluated every frame
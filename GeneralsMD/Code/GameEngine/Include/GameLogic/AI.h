@@ -1076,6 +1076,7 @@ protected:
 	Bool friend_moveVehicleToPos( const Coord3D *pos, CommandSourceType cmdSource );
 	void friend_moveFormationToPos( const Coord3D *pos, CommandSourceType cmdSource );
 	Bool friend_computeGroundPath( const Coord3D *pos, CommandSourceType cmdSource );
+	void buildGoalFields( const Coord3D *pos );	///< Prepares the pathfinder goal fields for a group move to pos.
 
 private:
 	// AIGroups must be created through TheAI->createGroup()
@@ -35,6 +35,8 @@
 #include "GameLogic/LocomotorSet.h"
 #include "GameLogic/GameLogic.h"
 
+#include <vector>
+
 class Bridge;
 class Object;
 class Weapon;
@@ -215,10 +217,26 @@ public:
 	static PathfindCellInfo * getACellInfo(PathfindCell *cell, const ICoord2D &pos);
 	static void releaseACellInfo(PathfindCellInfo *theInfo);
 
+	static Int getOpenHeapCount(void) { return s_openHeapCount; }	///< Number of cells on the open list
+	static PathfindCell *getOpenHeapCell(Int ndx) { return s_openHeap[ndx]->m_cell; } ///< Open cell by heap index, in no particular order
+
+protected:
+	static void openHeapPush(PathfindCellInfo *info);
+	static void openHeapRemove(PathfindCellInfo *info);
+	static void openHeapClear(void);
+	static void openHeapSiftUp(Int ndx);
+	static void openHeapSiftDown(Int ndx);
+	static PathfindCell *openHeapTop(void) { return s_openHeapCount>0 ? s_openHeap[0]->m_cell : nullptr; }
+	static Bool openHeapLess(const PathfindCellInfo *a, const PathfindCellInfo *b);
+
 protected:
 	static PathfindCellInfo *s_infoArray;
 	static PathfindCellInfo *s_firstFree;							///<
 
+	static PathfindCellInfo **s_openHeap;							///< Binary min heap of the open cells, keyed on total cost then insertion order.
+	static Int s_openHeapCount;												///< Number of cells in s_openHeap.
+	static UnsignedInt s_openSequence;								///< Insertion counter, reset whenever the open heap empties.
+
 
 	PathfindCellInfo *m_nextOpen, *m_prevOpen;						///< for A* "open" list, shared by closed list
 
@@ -227,6 +245,9 @@ protected:
 
 	UnsignedShort m_totalCost, m_costSoFar;	///< cost estimates for A* search
 
+	Int m_openHeapIndex;									///< Index in the open heap, or -1 if not in it.
+	UnsignedInt m_openSequence;						///< Order this cell was put on the open list, breaks total cost ties.
+
 	/// have to include cell's coordinates, since cells are often accessed via pointer only
 	ICoord2D m_pos;
 
@@ -301,10 +322,10 @@ public:
 
 	UnsignedInt costSoFar( PathfindCell *parent );
 
-	/// put self on "open" list in ascending cost order, return new list
+	/// put self on "open" list in ascending cost order, return new list (the cheapest open cell)
 	PathfindCell *putOnSortedOpenList( PathfindCell *list );
 
-	/// remove self from "open" list
+	/// remove self from "open" list, return new list (the cheapest open cell)
 	PathfindCell *removeFromOpenList( PathfindCell *list );
 
 	/// put self on "closed" list, return new list
@@ -365,6 +386,12 @@ public:
 	PathfindLayerEnum getConnectLayer( void ) const { return (PathfindLayerEnum)m_connectsToLayer; }				///< get the cell layer connect id
 
 private:
+#if RETAIL_COMPATIBLE_PATHFINDING
+	PathfindCell *putOnSortedOpenListRetail( PathfindCell *list );	///< Original sorted list insertion, kept until the fixed pathfinding is enabled
+	PathfindCell *removeFromOpenListRetail( PathfindCell *list );	///< Original sorted list removal
+	static Int releaseOpenListRetail( PathfindCell *list );				///< Original sorted list release
+#endif
+
 	PathfindCellInfo *m_info;
 	zoneStorageType m_zone:14;			///< Zone. Each zone is a set of adjacent terrain type.  If from & to in the same zone, you can successfully pathfind.  If not,
 														// you still may be able to if you can cross multiple terrain types.
@@ -441,6 +468,8 @@ private:
 #define PATHFIND_CELL_SIZE_F	10.0f
 
 enum { PATHFIND_QUEUE_LEN=512};
+enum { PATHFIND_GOAL_FIELDS=4};			///< Group move goal fields cached by the pathfinder.
+enum { PATHFIND_GOAL_FIELD_MIN_MEMBERS=8};	///< Smallest group that gets a goal field.
 
 struct TCheckMovementInfo;
 
@@ -452,12 +481,16 @@ struct TCheckMovementInfo;
  */
 class ZoneBlock
 {
+	friend class PathfindZoneManager;
+
 public:
 
 	ZoneBlock();
 	~ZoneBlock();  // not virtual, please don't override without making virtual.  jba.
 
 	void blockCalculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations.
+	Int blockLabelCells( PathfindCell **map, const IRegion2D &bounds );	///< Labels the raw zones of this block's cells 1..n, returns n.
+	void blockShiftZones( PathfindCell **map, const IRegion2D &bounds, Int delta );	///< Renumbers the zones of an unchanged block by delta.
 	zoneStorageType getEffectiveZone(LocomotorSurfaceTypeMask acceptableSurfaces, Bool crusher, zoneStorageType zone) const;
 
 	void clearMarkedPassable(void) {m_markedPassable = false;}
@@ -486,6 +519,43 @@ protected:
 	zoneStorageType *m_crusherZones;
 	Bool					m_interactsWithBridge;
 	Bool					m_markedPassable;
+
+	// TheSuperHackers @performance Cached state for incremental zone calculation.
+	enum ZoneLinkTarget
+	{
+		ZONE_LINK_SELF,
+		ZONE_LINK_LEFT,
+		ZONE_LINK_TOP,
+		ZONE_LINK_LAYER
+	};
+
+	enum ZoneLinkTables
+	{
+		ZONE_LINK_HIERARCHICAL	= 0x01,
+		ZONE_LINK_TERRAIN				= 0x02,
+		ZONE_LINK_CRUSHER				= 0x04,
+		ZONE_LINK_GROUND_WATER	= 0x08,
+		ZONE_LINK_GROUND_RUBBLE	= 0x10,
+		ZONE_LINK_GROUND_CLIFF	= 0x20
+	};
+
+	/**
+		An equivalency between one of this block's zones and a zone of this block, of the block
+		to the left or above, or of a layer. Zones are stored relative to their block's first zone,
+		so the links stay valid when the blocks get renumbered.
+	*/
+	struct ZoneLink
+	{
+		UnsignedByte m_zone;				///< Zone in this block.
+		UnsignedByte m_otherZone;		///< Zone in the other block, or the layer index.
+		UnsignedByte m_other;				///< ZoneLinkTarget
+		UnsignedByte m_tables;			///< ZoneLinkTables mask of the equivalency tables to combine the zones in.
+	};
+	void addZoneLink(Int zone, Int other, Int otherZone, Int tables);
+
+	std::vector<ZoneLink>	m_zoneLinks;
+	Bool					m_hasConnectLayerCells;	///< Any cell in the block connects to a layer.
+	Bool					m_zonesDirty;						///< Cells in the block changed since the last zone calculation.
 };
 typedef ZoneBlock *ZoneBlockP;
 
@@ -511,8 +581,11 @@ public:
 
 	Bool needToCalculateZones(void) const {return m_nextFrameToCalculateZones <= TheGameLogic->getFrame() ;} ///< Returns true if the zones need to be recalculated.
  	void markZonesDirty( Bool insert ) ; ///< Called when the zones need to be recalculated.
+ 	void markZonesDirty( Bool insert, const IRegion2D &cellBounds ) ; ///< Called when the cells in cellBounds changed and the zones need to be recalculated.
+	void invalidateZoneBlocks( void ) { m_allZoneBlocksDirty = true; ++m_mapChangeCount; } ///< Forces the next zone calculation to redo all blocks.
+	UnsignedInt getMapChangeCount( void ) const { return m_mapChangeCount; } ///< Changes every time the cells are reclassified.
  	void updateZonesForModify( PathfindCell **map,  PathfindLayer layers[], const IRegion2D &structureBounds, const IRegion2D &globalBounds ) ; ///< Called to recalculate an area when a structure has been removed.
-	void calculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations.
+	Bool calculateZones(	PathfindCell **map, PathfindLayer layers[], const IRegion2D &bounds);	///< Does zone calculations. Returns false if all blocks had to be recalculated.
 	zoneStorageType getEffectiveZone(LocomotorSurfaceTypeMask acceptableSurfaces, Bool crusher, zoneStorageType zone) const;
 	zoneStorageType getEffectiveTerrainZone(zoneStorageType zone) const;
 
@@ -539,6 +612,10 @@ private:
 	void freeZones(void);
 	void freeBlocks(void);
 
+	void scheduleZoneCalculation(void);
+	void getBlockBounds(Int xBlock, Int yBlock, const IRegion2D &globalBounds, IRegion2D &bounds) const;
+	void collectZoneLinks(PathfindCell **map, Int xBlock, Int yBlock, const IRegion2D &bounds, const IRegion2D &globalBounds);
+
 private:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
 	ZoneBlock			**m_zoneBlocks;						///< Zone blocks as a matrix - contains matrix indexing into the map.
@@ -553,6 +630,65 @@ private:
 	zoneStorageType *m_terrainZones;
 	zoneStorageType *m_crusherZones;
 	zoneStorageType *m_hierarchicalZones;
+
+	Bool					m_allZoneBlocksDirty;					///< Next zone calculation must redo every block.
+	UnsignedInt		m_mapChangeCount;							///< Bumped whenever cells change, so caches built from them can tell they are stale.
+
+	// TheSuperHackers @performance Counters comparing full and incremental zone calculations.
+	UnsignedInt		m_fullZoneCalcCount;
+	UnsignedInt		m_incrementalZoneCalcCount;
+	UnsignedInt		m_incrementalZoneBlockCount;	///< Blocks relabeled by incremental calculations.
+	Int64					m_fullZoneCalcTime;
+	Int64					m_incrementalZoneCalcTime;
+};
+
+/**
+ * TheSuperHackers @performance Ground costs to a group move destination, found by one Dijkstra search
+ * outward from the goal cell over the cells a locomotor surface mask can enter. Members of a large group
+ * head for goals close to that destination, so their searches walk down the field like a flow field, and
+ * only search the last stretch to their own goal, instead of each flooding the same obstacles.
+ */
+class PathfindGoalField
+{
+public:
+	enum { UNREACHED = 0xffffffff };
+
+	PathfindGoalField();
+	~PathfindGoalField();
+
+	void reset(void);	///< Frees the costs, and forgets the goal.
+
+	Bool isCurrent(LocomotorSurfaceTypeMask surfaces, UnsignedInt mapChangeCount) const
+	{
+		return m_costs != nullptr && m_surfaces == surfaces && m_mapChangeCount == mapChangeCount;
+	}
+	Bool isGoal(const ICoord2D &goalCell, zoneStorageType zone) const
+	{
+		return m_goalCell.x == goalCell.x && m_goalCell.y == goalCell.y && m_zone == zone;
+	}
+
+	/// Cost from the goal to cell (x,y), or UNREACHED if the search didn't get there.
+	UnsignedInt getCost(Int x, Int y) const
+	{
+		if (x < m_extent.lo.x || x > m_extent.hi.x || y < m_extent.lo.y || y > m_extent.hi.y) {
+			return UNREACHED;
+		}
+		return m_costs[(x-m_extent.lo.x)*m_height + (y-m_extent.lo.y)];
+	}
+	/// Every cell up to this cost is final, costs above it are only upper bounds.
+	UnsignedInt getSearchedCost(void) const { return m_searchedCost; }
+
+private:
+	friend class Pathfinder;
+
+	UnsignedInt *m_costs;						///< Cost from the goal per cell, column major like the pathfind map.
+	IRegion2D m_extent;							///< Cells covered by m_costs.
+	Int m_height;										///< Cells in y.
+	ICoord2D m_goalCell;						///< Goal cell the search started from.
+	zoneStorageType m_zone;					///< Effective zone of the goal cell.
+	LocomotorSurfaceTypeMask m_surfaces;	///< Surfaces the search could enter.
+	UnsignedInt m_mapChangeCount;		///< Zone manager map change count the costs were built against.
+	UnsignedInt m_searchedCost;			///< See getSearchedCost().
 };
 
 /**
@@ -632,6 +768,9 @@ public:
 
 	Bool queueForPath(ObjectID id);	 ///< The object wants to request a pathfind, so put it on the list to process.
 	void processPathfindQueue(void); ///< Process some or all of the queued pathfinds.
+	Int getQueuedPathfindRequestCount(void) const; ///< Number of requests waiting in the pathfind queue.
+	void buildGoalField(const Coord3D *goal, LocomotorSurfaceTypeMask surfaces,
+		const Coord3D *starts, Int numStarts); ///< Prepares a goal field for a group moving from starts to goal.
 	void forceMapRecalculation( );	///< Force pathfind map recomputation. If region is given, only that area is recomputed
 
 	/** Returns an aircraft path to the goal.  */
@@ -829,6 +968,15 @@ protected:
 	void debugShowSearch( Bool pathFound );				///< Show all cells touched in the last search
 	static LocomotorSurfaceTypeMask validLocomotorSurfacesForCellType(PathfindCell::CellType t);
 
+	void updateQueueStats(Int backlog, UnsignedInt pathsServed, Real serveTimeMS);	///< Accumulates and periodically reports the pathfind queue throughput.
+	const PathfindGoalField *findGoalField(LocomotorSurfaceTypeMask surfaces, const ICoord2D &goalCell,
+		UnsignedInt &goalCost) const;	///< The current goal field closest to goalCell that reached it, if any.
+	Bool isGoalFieldCellPassable(LocomotorSurfaceTypeMask surfaces, Int x, Int y);	///< True if a goal field search may enter cell (x,y).
+	UnsignedInt costToGoal(PathfindCell *cell, PathfindCell *goalCell) const;	///< Estimated cost from cell to goalCell, tightened by the active goal field.
+	void continueGoalField(Int cellBudget);	///< Continues building the goal field under construction, for up to cellBudget cells.
+	void resetGoalFields(void);	///< Frees all goal fields, and stops the one under construction.
+	PathfindCell *descendGoalField(PathfindCell *startCell, PathfindCell *goalCell, const Object *obj,
+		const LocomotorSet& locomotorSet, Bool isHuman, Bool centerInCell, Int radius);	///< Walks the search start down the active goal field.
 	void checkChangeLayers(PathfindCell *parentCell);
 
 	bool checkCellOutsideExtents(ICoord2D& cell);
@@ -873,6 +1021,31 @@ private:
 	Int						m_queuePRHead;
 	Int						m_queuePRTail;
 	Int						m_cumulativeCellsAllocated;
+
+	// TheSuperHackers @performance Pathfind queue throughput since the last report.
+	UnsignedInt		m_queueStatFrames;				///< Frames the queue was served in.
+	UnsignedInt		m_queueStatPaths;					///< Requests served.
+	UnsignedInt		m_queueStatCells;					///< Cells examined serving them.
+	Int						m_queueStatMaxBacklog;		///< Longest queue seen.
+	Int						m_queueStatMaxFrameCells;	///< Most cells examined in a single frame.
+	Real					m_queueStatTimeMS;				///< Milliseconds spent serving the requests.
+	Real					m_queueStatMaxFrameTimeMS;	///< Most milliseconds spent in a single frame.
+	UnsignedInt		m_queueStatFieldsBuilt;		///< Goal fields built.
+	UnsignedInt		m_queueStatFieldCells;		///< Cells reached building them.
+	UnsignedInt		m_queueStatFieldPaths;		///< Searches steered by a goal field.
+
+	// TheSuperHackers @performance Goal fields for group moves.
+	PathfindGoalField	m_goalFields[PATHFIND_GOAL_FIELDS];
+	Int						m_nextGoalField;					///< Slot the next new goal field replaces.
+	const PathfindGoalField *m_activeGoalField;	///< Goal field steering the current search, if any.
+	UnsignedInt		m_activeGoalFieldGoalCost;	///< Active goal field's cost at the search goal.
+	std::vector<Int>	m_goalFieldBuckets[16];		///< Dijkstra bucket queue, kept between the frames of a build.
+	PathfindGoalField *m_buildingGoalField;		///< Goal field still being built, if any.
+	std::vector<ICoord2D> m_goalFieldPendingStarts;	///< Starts the goal field under construction hasn't reached yet.
+	UnsignedInt		m_goalFieldBuildCost;				///< Bucket the goal field build continues with.
+	Int						m_goalFieldBuildQueued;			///< Cells queued in the buckets.
+	UnsignedInt		m_goalFieldNextStartCheck;	///< Cost to check the pending starts again at.
+	UnsignedInt		m_goalFieldStopCost;				///< Cost the build stops at, once all starts are reached.
 };
 
 
@@ -41,12 +41,18 @@ class Xfer;
 class Anim2DTemplate;
 class Anim2D;
 class Object;
+class EngineComponent;
 #include <map>
 #include <vector>
 
 // Forward declaration to match definition in BodyModule.h
 enum BodyDamageType CPP_11(: Int);
 
+// TheSuperHackers @performance Component names are registered once at INI load and get a small dense index,
+// so bodies can find a component by array index instead of comparing names every frame.
+typedef Int ComponentNameIndex;
+enum { INVALID_COMPONENT_NAME_INDEX = -1 };
+
 
 // TheSuperHackers @feature author 15/01/2025 Component functionality status
 enum ComponentStatus
@@ -81,6 +87,7 @@ public:
 
 protected:
 	AsciiString m_name;						///< Component name (Engine, Turret, Wheels, Gun, etc.)
+	ComponentNameIndex m_nameIndex;			///< Registered index of m_name, see Component::findNameIndex
 	UnicodeString m_displayName;			///< Display name for this component
 	AsciiString m_icon;						///< Icon name for this component
 	AsciiString m_displayDescription;				///< Display description label for this component
@@ -111,11 +118,19 @@ protected:
 	
 
 public:
-	Component() : m_name(), m_displayName(), m_icon(), m_displayDescription(), m_maxHealth(0.0f), m_initialHealth(0.0f), m_healingType(COMPONENT_HEALING_NORMAL), m_damageOnSides(), m_replacementCost(0), m_forceReturnOnDestroy(FALSE), m_maxHealthValueType(VALUE_TYPE_ABSOLUTE), m_initialHealthValueType(VALUE_TYPE_ABSOLUTE), m_damagedDamageType((BodyDamageType)0), m_destroyedDamageType((BodyDamageType)0), m_currentHealth(0.0f), m_currentMaxHealth(0.0f), m_partiallyFunctionalIcon(NULL), m_downedIcon(NULL), m_userDisabledIcon(NULL), m_userDisabled(FALSE), m_object(NULL) {}
+	Component() : m_name(), m_nameIndex(INVALID_COMPONENT_NAME_INDEX), m_displayName(), m_icon(), m_displayDescription(), m_maxHealth(0.0f), m_initialHealth(0.0f), m_healingType(COMPONENT_HEALING_NORMAL), m_damageOnSides(), m_replacementCost(0), m_forceReturnOnDestroy(FALSE), m_maxHealthValueType(VALUE_TYPE_ABSOLUTE), m_initialHealthValueType(VALUE_TYPE_ABSOLUTE), m_damagedDamageType((BodyDamageType)0), m_destroyedDamageType((BodyDamageType)0), m_currentHealth(0.0f), m_currentMaxHealth(0.0f), m_partiallyFunctionalIcon(NULL), m_downedIcon(NULL), m_userDisabledIcon(NULL), m_userDisabled(FALSE), m_object(NULL) {}
 
 	// Accessors for configuration/state
 	const AsciiString& getName() const { return m_name; }
-	void setName(const AsciiString& n) { m_name = n; }
+	void setName(const AsciiString& n);
+	ComponentNameIndex getNameIndex() const { return m_nameIndex; }
+
+	// Returns the registered index for a component name, registering it if needed. Empty names have no index.
+	static ComponentNameIndex findNameIndex(const AsciiString& name);
+	static Int getNameIndexCount();
+
+	// Lets callers get at the engine interface without a dynamic_cast.
+	virtual EngineComponent* asEngineComponent() { return NULL; }
 	UnicodeString getDisplayName() const;
 	inline const AsciiString& getIcon() const { return m_icon; }
 	inline const AsciiString& getDisplayDescription() const { return m_displayDescription; }
@@ -192,10 +207,10 @@ public:
 	virtual void loadPostProcess( void );
 
 	// TheSuperHackers @feature Ahmed Salah 15/01/2025 Aggregate Jamming helpers (operate on lists of components)
-	static Real getTotalComponentJammingDamageCap(const std::vector<Component>& components);
-	static Real getEffectiveJammingDamageCap(Real globalCap, const std::vector<Component>& components);
-	static UnsignedInt getFastestComponentJammingHealRate(const std::vector<Component>& components, UnsignedInt globalRate);
-  static Real getTotalComponentJammingHealAmount(const std::vector<Component>& components, Real globalAmount);
+	static Real getTotalComponentJammingDamageCap(const std::vector<Component*>& components);
+	static Real getEffectiveJammingDamageCap(Real globalCap, const std::vector<Component*>& components);
+	static UnsignedInt getFastestComponentJammingHealRate(const std::vector<Component*>& components, UnsignedInt globalRate);
+  static Real getTotalComponentJammingHealAmount(const std::vector<Component*>& components, Real globalAmount);
 
 };
 
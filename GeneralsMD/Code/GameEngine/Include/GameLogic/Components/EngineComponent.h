@@ -72,6 +72,8 @@ public:
 	static void parseEngineComponent(INI* ini, void* instance, void* /*store*/, const void* /*userData*/);
 	static void buildFieldParse(MultiIniFieldParse& p);
 
+	virtual EngineComponent* asEngineComponent() { return this; }
+
 	// TheSuperHackers @feature Ahmed Salah 15/01/2025 Default main engine component name constant
 	static const char* DEFAULT_MAIN_ENGINE_COMPONENT_NAME;
 
@@ -164,7 +164,9 @@ public:
 
 	// TheSuperHackers @feature author 15/01/2025 Component dependency system
 	std::vector<AsciiString> m_affectedByComponents;			///< List of component names that affect this locomotor's functionality
+	std::vector<ComponentNameIndex> m_affectedByComponentIndices;	///< TheSuperHackers @performance Name index of each m_affectedByComponents entry
 	AsciiString								m_engineComponentName;		///< TheSuperHackers @feature Ahmed Salah 30/10/2025 Engine component name (INI), default uses EngineComponent::DEFAULT_MAIN_ENGINE_COMPONENT_NAME
+	ComponentNameIndex				m_engineComponentNameIndex;	///< TheSuperHackers @performance Name index of the engine component, falls back to the default name
 
 protected:
 
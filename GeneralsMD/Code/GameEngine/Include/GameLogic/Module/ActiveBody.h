@@ -70,6 +70,13 @@ public:
 
 	std::vector<Component*> m_componentsData;		///< TheSuperHackers @feature author 15/01/2025 Template component data (copied to instances on construction)
 
+	// TheSuperHackers @performance Every instance copies m_componentsData in order, so a component's index in
+	// this template is also its index in each instance. Maps ComponentNameIndex to that slot, or -1.
+	Int getComponentSlot(ComponentNameIndex nameIndex) const;
+
+	// Component parsers add through here so the slot table is dropped whenever m_componentsData changes.
+	void addComponentData(Component* component);
+
 	ActiveBodyModuleData();
 	virtual ~ActiveBodyModuleData();
 
@@ -80,6 +87,9 @@ public:
 
 	// TheSuperHackers @feature author 01/01/2025 Override getModuleOrder for display ordering
 	virtual Int getModuleOrder() const { return 150; } // Second priority - shows after RebuildHoleBehavior
+
+private:
+	mutable std::vector<Short> m_componentSlots;		///< Slot per ComponentNameIndex, built on first lookup
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -168,7 +178,10 @@ public:
 	virtual void initializeComponentHealth();
 	
 	// TheSuperHackers @feature author 15/01/2025 Get component definitions - now inherited from BodyModule
-	virtual std::vector<Component> getComponents() const;
+	virtual const std::vector<Component*>& getComponents() const { return m_components; }
+	virtual Bool hasComponents() const { return !m_components.empty(); }
+	virtual Int componentCount() const { return (Int)m_components.size(); }
+	virtual Component* getComponentByNameIndex(ComponentNameIndex nameIndex) const;
 	
 	// TheSuperHackers @feature author 15/01/2025 Get icon to draw for component status
 	// Call repeatedly to get all component icons (returns NULL when no more)
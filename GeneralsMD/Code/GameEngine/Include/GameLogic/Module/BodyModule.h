@@ -262,7 +262,12 @@ public:
 	virtual void initializeComponentHealth() = 0;
 	
 	// TheSuperHackers @feature author 15/01/2025 Get component definitions
-	virtual std::vector<Component> getComponents() const = 0;
+	// Returns a view of the instance components, owned by the body. Do not hold on to it past the body's lifetime.
+	virtual const std::vector<Component*>& getComponents() const = 0;
+	virtual Bool hasComponents() const = 0;
+	virtual Int componentCount() const = 0;
+	// TheSuperHackers @performance Find a component by its registered name index instead of comparing names.
+	virtual Component* getComponentByNameIndex(ComponentNameIndex nameIndex) const = 0;
 	
 	// TheSuperHackers @feature author 15/01/2025 Get icon to draw for component status
 	// Iterates through components internally and returns the next component's status icon found (NULL when no more)
@@ -379,7 +384,19 @@ public:
 	virtual void initializeComponentHealth() { }
 	
 	// TheSuperHackers @feature author 15/01/2025 Get component definitions - must be implemented by derived classes
-	virtual std::vector<Component> getComponents() const = 0;
+	virtual const std::vector<Component*>& getComponents() const = 0;
+	virtual Bool hasComponents() const { return !getComponents().empty(); }
+	virtual Int componentCount() const { return (Int)getComponents().size(); }
+	virtual Component* getComponentByNameIndex(ComponentNameIndex nameIndex) const
+	{
+		const std::vector<Component*>& components = getComponents();
+		for (std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it)
+		{
+			if ((*it)->getNameIndex() == nameIndex)
+				return *it;
+		}
+		return NULL;
+	}
 	
 	// TheSuperHackers @feature author 15/01/2025 Get icon to draw for component status - default implementation returns NULL
 	virtual Anim2D* getComponentStatusIcon() const { return NULL; }
@@ -64,7 +64,9 @@ public:
 	virtual void internalChangeHealth( Real delta );
 
 	// Component APIs (empty implementations for inactive bodies)
-	virtual std::vector<Component> getComponents() const { return std::vector<Component>(); }
+	virtual const std::vector<Component*>& getComponents() const { static const std::vector<Component*> noComponents; return noComponents; }
+	virtual Bool hasComponents() const { return FALSE; }
+	virtual Int componentCount() const { return 0; }
 
 	template<typename TComponent>
 	TComponent* GetComponent(const AsciiString& /*componentName*/) const
@@ -100,6 +100,7 @@ class UpdateModuleInterface;
 class UpgradeModule;
 class UpgradeModuleInterface;
 class UpgradeTemplate;
+class XferCRC;
 
 class ObjectHeldHelper;
 class ObjectDisabledHelper;
@@ -342,7 +343,8 @@ public:
 	BodyModuleInterface* getBodyModule() const { return m_body; }
 	
 	// TheSuperHackers @feature author 15/01/2025 Get component information from ActiveBody
-	std::vector<Component> getComponents() const;
+	const std::vector<Component*>& getComponents() const;
+	Bool hasComponents() const;
 	
 	ContainModuleInterface* getContain() const { return m_contain; }
   StealthUpdate*          getStealth() const { return m_stealth; }
@@ -780,6 +782,11 @@ public:
 	// player. These are friend_s for player.
 	void friend_adjustPowerForPlayer( Bool incoming );
 
+	// TheSuperHackers @performance Incremental logic CRC. The CRC steps of crc() are cached and replayed
+	// until something that crc() reads has changed and the object was marked dirty.
+	void markCRCDirty() const { m_crcStepsValid = FALSE; }
+	void crcIncremental( XferCRC *xfer, Bool validate );
+
 protected:
 
 	void setOrRestoreTeam( Team* team, Bool restoring );
@@ -967,6 +974,8 @@ private:
 
 	UnsignedInt										m_safeOcclusionFrame;	///<flag used by occlusion renderer so it knows when objects have exited their production building.
 
+	std::vector<UnsignedInt>			m_crcSteps;						///< cached CRC steps of crc() for the incremental logic CRC
+
 	// --------- BYTE-SIZED THINGS GO HERE
 	Bool													m_isSelectable;
 	Bool													m_modulesReady;
@@ -978,6 +987,7 @@ private:
 	Byte													m_numTriggerAreasActive;
 	Bool													m_singleUseCommandUsed;
 	Bool													m_isReceivingDifficultyBonus;
+	mutable Bool									m_crcStepsValid;				///< m_crcSteps matches the current state
 
 };
 
@@ -228,6 +228,8 @@ public:
 	void removeSequentialScript(SequentialScript *scriptToRemove);
 	void notifyOfTeamDestruction(Team *teamDestroyed);
 	void notifyOfObjectCreationOrDestruction(void);
+	void notifyOfTeamChange(Team *team);	///< A team instance, its members or their alive state or locomotors changed
+	void notifyOfTriggerAreaChange(const PolygonTrigger *trigger);	///< An object entered or exited the trigger area
 	UnsignedInt getFrameObjectCountChanged(void) {return m_frameObjectCountChanged;}
 	void setSequentialTimer(Object *obj, Int frameCount);
 	void setSequentialTimer(Team *team, Int frameCount);
@@ -247,6 +249,7 @@ public:
 	virtual void runScript(const AsciiString& scriptName, Team *pThisTeam=nullptr); ///<  Runs a script.
 	virtual void runObjectScript(const AsciiString& scriptName, Object *pThisObject=nullptr); ///<  Runs a script attached to this object.
 	virtual Team *getTeamNamed(const AsciiString& teamName); ///<  Gets the named team.  May be null.
+	Team *getTeamNamed(const Parameter *teamParm); ///< Gets the team named by a parameter, binding it on first use.  May be null.
 	virtual Player *getSkirmishEnemyPlayer(void); ///< Gets the ai's enemy Human player. May be null.
 	virtual Player *getCurrentPlayer(void); ///<  Gets the player that owns the current script.  May be null.
 	virtual Player *getPlayerFromAsciiString(const AsciiString& skirmishPlayerString);
@@ -267,6 +270,7 @@ public:
 
 	/// Return the trigger area with the given name
 	virtual PolygonTrigger *getQualifiedTriggerAreaByName( AsciiString name );
+	PolygonTrigger *getQualifiedTriggerAreaByName( const Parameter *triggerParm ); ///< As above, binding the parameter on first use.
 
 	// For other systems to evaluate Conditions, execute Actions, etc.
 
@@ -275,6 +279,7 @@ public:
 	virtual void friend_executeAction( ScriptAction *pActionHead, Team *pThisTeam = nullptr);	///< Use this at yer peril.
 
 	virtual Object *getUnitNamed(const AsciiString& unitName); ///< Gets the named unit. May be null.
+	Object *getUnitNamed(const Parameter *unitParm); ///< Gets the unit named by a parameter, binding it on first use. May be null.
 	virtual Bool didUnitExist(const AsciiString& unitName);
 	virtual void addObjectToCache( Object* pNewObject );
 	virtual void removeObjectFromCache( Object* pDeadObject );
@@ -307,6 +312,7 @@ public:
 	void turnBreezeOff(void) {m_breezeInfo.m_intensity = 0.0f;}
 
 	Bool isTimeFrozenScript( void );		///< Ask whether a script has frozen time or not
+	Int getScriptScheduleMismatchCount( void ) const { return m_scriptScheduleMismatches; }	///< Scheduled evaluations that differed from polling, with -verifyScriptSchedule
 	void doFreezeTime( void );
 	void doUnfreezeTime( void );
 
@@ -392,6 +398,19 @@ protected:
 	Bool evaluateFlag( Condition *pCondition );
 	Bool evaluateTimer( Condition *pCondition );
 	Bool evaluateCondition( Condition *pCondition );
+	Bool evaluateScheduledConditions( Script *pScript );
+	void verifyScheduledConditions( Script *pScript, Bool scheduledResult );
+	void buildScriptSchedule( void );
+	void clearScriptSchedule( void );
+	void scheduleScript( Script *pScript );
+	TeamPrototype *getScheduledTeam( const Parameter *teamParm );
+	PolygonTrigger *getScheduledTriggerArea( const Parameter *triggerParm );
+	void markCounterChanged( Int counterNdx );
+	void markFlagChanged( Int flagNdx );
+	void markUIInteractionsChanged( void );
+	Team *getTeamFromPrototype( TeamPrototype *theTeamProto, const AsciiString& teamName );
+	PolygonTrigger *getPerimeterTriggerArea( Int perimeter );
+	void countParameterLookup( Bool bound );
 	void executeActions( ScriptAction *pActionHead );
 
 	void setPriorityThing( ScriptAction *pAction );
@@ -429,6 +448,23 @@ protected:
 	Int								m_numCounters;
 	TFlag							m_flags[MAX_FLAGS];
 	Int								m_numFlags;
+
+	// TheSuperHackers @performance Scripts whose conditions only read counters, flags, timers, team
+	// membership and team trigger area presence are re-evaluated when one of those changes instead of
+	// every time they are polled. Counters and flags are registered by name, so building the schedule
+	// allocates none; the index tables are filled in as the names get allocated.
+	typedef std::vector<Script*> ScheduledScripts;
+	typedef std::map<AsciiString, ScheduledScripts> ScheduledScriptsByName;
+	typedef std::map<const TeamPrototype*, ScheduledScripts> ScheduledScriptsByTeam;
+	typedef std::map<const PolygonTrigger*, ScheduledScripts> ScheduledScriptsByTriggerArea;
+	ScheduledScriptsByName	m_counterScriptsByName;		///< Scheduled scripts reading each counter or timer name.
+	ScheduledScriptsByName	m_flagScriptsByName;			///< Scheduled scripts reading each flag name.
+	ScheduledScripts				*m_counterScripts[MAX_COUNTERS];	///< Scheduled scripts reading each allocated counter, or null.
+	ScheduledScripts				*m_flagScripts[MAX_FLAGS];				///< Scheduled scripts reading each allocated flag, or null.
+	ScheduledScriptsByTeam	m_teamScripts;						///< Scheduled scripts reading each team's members.
+	ScheduledScriptsByTriggerArea	m_triggerAreaScripts;	///< Scheduled scripts reading who is inside each trigger area.
+	Bool							m_scriptScheduleBuilt;
+	Int								m_scriptScheduleMismatches;	///< See getScriptScheduleMismatchCount().
 	AttackPriorityInfo m_attackPriorityInfo[MAX_ATTACK_PRIORITIES];
 	Int								m_numAttackInfo;
 	Int								m_endGameTimer;
@@ -438,6 +474,16 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+
+	// TheSuperHackers @performance Parameters bound to teams and trigger areas stay valid until
+	// m_bindingGeneration moves on (reset, new map, load). Parameters bound to named objects hold an
+	// index into m_namedObjects and stay valid until an entry is added, renamed or the cache is cleared.
+	enum { PERIMETER_MY_INNER, PERIMETER_MY_OUTER, PERIMETER_ENEMY_INNER, PERIMETER_ENEMY_OUTER };
+	enum { PERIMETER_SLOTS = MAX_PLAYER_COUNT+2 }; ///< Start index -1 .. MAX_PLAYER_COUNT
+	UnsignedInt				m_bindingGeneration;
+	UnsignedInt				m_namedObjectsGeneration;
+	PolygonTrigger		*m_perimeterTriggers[2][PERIMETER_SLOTS];
+	UnsignedInt				m_perimeterTriggerGenerations[2][PERIMETER_SLOTS];
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
@@ -489,6 +535,11 @@ protected:
 	double						m_totalUpdateTime;
 	double						m_maxUpdateTime;
 	double						m_curUpdateTime;
+	Int								m_profileConditionType;
+	Int								m_boundParameterLookups[Condition::NUM_ITEMS+1];	///< Lookups served by a parameter binding.
+	Int								m_namedParameterLookups[Condition::NUM_ITEMS+1];	///< Lookups that had to resolve the name.
+	Int								m_scheduledScriptEvaluations;
+	Int								m_scheduledScriptSkips;
 #endif
 #endif
 
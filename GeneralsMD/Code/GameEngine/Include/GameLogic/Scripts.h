@@ -69,7 +69,9 @@
 #define OUTER_PERIMETER "OuterPerimeter"
 
 class Parameter;
+class PolygonTrigger;
 class Script;
+class TeamPrototype;
 class OrCondition;
 class Condition;
 class DataChunkInput;
@@ -632,6 +634,9 @@ protected:	// Note - If you add any member vars, you must take them into account
 	Real				m_conditionTime;		///< Amount of time (cum) to evaluate conditions.
 	Real				m_curTime;		///< Amount of time (cum) to evaluate conditions.
 	Int					m_conditionExecutedCount; ///< Number of times conditions evaluated.
+	Bool				m_conditionsScheduled; ///< Runtime, ScriptEngine only. Conditions are re-evaluated only when something they read changes.
+	Bool				m_conditionsChanged; ///< Runtime, ScriptEngine only. Something a scheduled script reads changed since it was last evaluated.
+	Bool				m_scheduledConditionResult; ///< Runtime, ScriptEngine only. Result of the last evaluation of a scheduled script.
 
 public:
 	Script();
@@ -662,12 +667,18 @@ public:
 	void addToConditionTime(Real time) {m_conditionTime += time;}
 	void setCurTime(Real time) {m_curTime	= time;}
 	void setDelayEvalSeconds(Int delay) {m_delayEvaluationSeconds = delay;}
+	void setConditionsScheduled(Bool scheduled) {m_conditionsScheduled = scheduled; m_conditionsChanged = true;}
+	void markConditionsChanged(void) {m_conditionsChanged = true;}
+	void setScheduledConditionResult(Bool result) {m_scheduledConditionResult = result; m_conditionsChanged = false;}
 
 	UnsignedInt getFrameToEvaluate(void) {return m_frameToEvaluateAt;}
 	Int getConditionCount(void) {return m_conditionExecutedCount;}
 	Real getConditionTime(void) {return m_conditionTime;}
 	Real getCurTime(void) {return m_curTime;}
 	Int getDelayEvalSeconds(void) {return m_delayEvaluationSeconds;}
+	Bool isConditionsScheduled(void) const {return m_conditionsScheduled;}
+	Bool haveConditionsChanged(void) const {return m_conditionsChanged;}
+	Bool getScheduledConditionResult(void) const {return m_scheduledConditionResult;}
 
 	AsciiString getName(void) const { return m_scriptName;}
 	AsciiString getComment(void) const {return m_comment;}
@@ -795,11 +806,29 @@ public:
 		m_initialized(false),
 		m_paramType(type),
 		m_int(val),
-		m_real(0)
+		m_real(0),
+		m_bindingType(BINDING_NONE),
+		m_bindingGeneration(0),
+		m_boundTeam(nullptr),
+		m_boundTrigger(nullptr),
+		m_boundIndex(-1)
 	{
 		m_coord.x=0;m_coord.y=0;m_coord.z=0;
 	}
 
+	// TheSuperHackers @performance Team, unit and trigger parameters are resolved by the ScriptEngine
+	// the first time they are evaluated and keep the resolved handle until the engine's binding
+	// generation moves on, so conditions don't repeat the name lookups every evaluation.
+	enum BindingType
+	{
+		BINDING_NONE,					///< Not bound yet, or bound in an older generation.
+		BINDING_BY_NAME,			///< Context dependent name (THIS_TEAM, THIS_OBJECT...), always looked up by name.
+		BINDING_TEAM,					///< m_boundTeam, may be null if the team doesn't exist.
+		BINDING_UNIT,					///< m_boundIndex into the named objects cache, -1 if not named yet.
+		BINDING_TRIGGER,			///< m_boundTrigger, may be null if the area doesn't exist.
+		BINDING_PERIMETER			///< m_boundIndex is the skirmish perimeter, resolved per player.
+	};
+
 private:
 	ParameterType	m_paramType;
 	Bool					m_initialized;
@@ -809,11 +838,17 @@ private:
 	Coord3D				m_coord;
 	ObjectStatusMaskType m_objectStatus;
 
+	mutable BindingType			m_bindingType;
+	mutable UnsignedInt			m_bindingGeneration;
+	mutable TeamPrototype		*m_boundTeam;
+	mutable PolygonTrigger	*m_boundTrigger;
+	mutable Int							m_boundIndex;
+
 protected:
 	void setInt(Int i) {m_int = i;}
 	void setReal(Real r) {m_real = r;}
 	void setCoord3D(const Coord3D *pLoc);
-	void setString(AsciiString s) {m_string = s;}
+	void setString(AsciiString s) {m_string = s; clearBinding();}
 	void setStatus( ObjectStatusMaskType objectStatus ) { m_objectStatus.set( objectStatus ); }
 
 public:
@@ -826,7 +861,17 @@ public:
 	void friend_setInt(Int i) {m_int = i;}
 	void friend_setReal(Real r) {m_real = r;}
 	void friend_setCoord3D(const Coord3D *pLoc) { setCoord3D(pLoc); }
-	void friend_setString(AsciiString s) {m_string = s;}
+	void friend_setString(AsciiString s) {m_string = s; clearBinding();}
+
+	BindingType getBindingType(UnsignedInt generation) const { return m_bindingGeneration == generation ? m_bindingType : BINDING_NONE; }
+	TeamPrototype *getBoundTeam(void) const { return m_boundTeam; }
+	PolygonTrigger *getBoundTrigger(void) const { return m_boundTrigger; }
+	Int getBoundIndex(void) const { return m_boundIndex; }
+	void bindTeam(UnsignedInt generation, TeamPrototype *proto) const { bind(BINDING_TEAM, generation); m_boundTeam = proto; }
+	void bindTrigger(UnsignedInt generation, PolygonTrigger *trigger) const { bind(BINDING_TRIGGER, generation); m_boundTrigger = trigger; }
+	void bindIndex(BindingType type, UnsignedInt generation, Int index) const { bind(type, generation); m_boundIndex = index; }
+	void bindByName(UnsignedInt generation) const { bind(BINDING_BY_NAME, generation); }
+	void clearBinding(void) const { m_bindingType = BINDING_NONE; m_bindingGeneration = 0; }
 
 	void qualify(const AsciiString& qualifier,const AsciiString& playerTemplateName,const AsciiString& newPlayerName);
 
@@ -836,6 +881,16 @@ public:
 	void WriteParameter(DataChunkOutput &chunkWriter);
 	static Parameter *ReadParameter(DataChunkInput &file);
 
+private:
+	void bind(BindingType type, UnsignedInt generation) const
+	{
+		m_bindingType = type;
+		m_bindingGeneration = generation;
+		m_boundTeam = nullptr;
+		m_boundTrigger = nullptr;
+		m_boundIndex = -1;
+	}
+
 };
 EMPTY_DTOR(Parameter)
 
@@ -52,6 +52,7 @@ class WeaponUpgrade;
 class INI;
 class ParticleSystemTemplate;
 class SimpleObjectIterator;
+class ObjectSpan;
 enum NameKeyType CPP_11(: Int);
 //-------------------------------------------------------------------------------------------------
 const Int NO_MAX_SHOTS_LIMIT = 0x7fffffff;
@@ -472,6 +473,7 @@ public:
 
 	// TheSuperHackers @feature author 15/01/2025 Component dependency system
 	std::vector<AsciiString> m_affectedByComponents;			///< List of component names that affect this weapon's functionality
+	std::vector<Int> m_affectedByComponentIndices;				///< TheSuperHackers @performance ComponentNameIndex of each m_affectedByComponents entry
 
 	inline DeathType getDeathType() const { return m_deathType; }
 	inline Real getContinueAttackRange() const { return m_continueAttackRange; }
@@ -532,17 +534,19 @@ public:
 	
 	// TheSuperHackers @feature author 15/01/2025 Weapon component dependency
 	AsciiString m_componentName;								///< Name of the component this weapon depends on for functionality
+	Int m_componentNameIndex;										///< TheSuperHackers @performance ComponentNameIndex of m_componentName
 
 protected:
 
 	// actually deal out the damage.
 	// TheSuperHackers @feature author 02/10/2025 Prepare list of applicable affected victims
-	std::vector<Object*> getApplicableAffectedVictims(
-		SimpleObjectIterator* iter,
-		Object* curVictim,
+	// TheSuperHackers @performance Works on stack spans so splash damage does no heap allocations
+	void getApplicableAffectedVictims(
+		const ObjectSpan& candidates,
 		const Object* source,
 		const Object* primaryVictim,
-		Int affects
+		Int affects,
+		ObjectSpan& applicableVictims
 	) const;
 	
 	void dealDamageInternal(ObjectID sourceID, ObjectID victimID, const Coord3D *pos, const WeaponBonus& bonus, Bool isProjectileDetonation) const;
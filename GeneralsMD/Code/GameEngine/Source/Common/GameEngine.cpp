@@ -40,6 +40,7 @@
 #include "Common/GameAudio.h"
 #include "Common/GameEngine.h"
 #include "Common/INI.h"
+#include "Common/INICache.h"
 #include "Common/INIException.h"
 #include "Common/MessageStream.h"
 #include "Common/ThingFactory.h"
@@ -395,6 +396,9 @@ GameEngine::~GameEngine()
 	delete TheNameKeyGenerator;
 	TheNameKeyGenerator = nullptr;
 
+	delete TheINICache;
+	TheINICache = nullptr;
+
 	delete TheFileSystem;
 	TheFileSystem = nullptr;
 
@@ -554,6 +558,13 @@ void GameEngine::init()
 	#endif/////////////////////////////////////////////////////////////////////////////////////////////
 
 
+		// TheSuperHackers @performance Load the pre-tokenized INI cache before the first INI file is read
+		if (TheGlobalData->m_useINICache)
+		{
+			TheINICache = MSGNEW("GameEngineSubsystem") INICache;
+			TheINICache->load(INICache::getDefaultFilename());
+		}
+
 		DEBUG_ASSERTCRASH(TheWritableGlobalData,("TheWritableGlobalData expected to be created"));
 		initSubsystem(TheWritableGlobalData, "TheWritableGlobalData", TheWritableGlobalData, &xferCRC, "Data\\INI\\Default\\GameData", "Data\\INI\\GameData");
 		TheWritableGlobalData->parseCustomDefinition();
@@ -756,6 +767,10 @@ void GameEngine::init()
 		TheWritableGlobalData->m_iniCRC = xferCRC.getCRC();
 		DEBUG_LOG(("INI CRC is 0x%8.8X", TheGlobalData->m_iniCRC));
 
+		// TheSuperHackers @performance Write back the INI files that were missing from the cache or had changed
+		if (TheINICache != nullptr && TheINICache->isDirty())
+			TheINICache->save(INICache::getDefaultFilename());
+
 		TheSubsystemList->postProcessLoadAll();
 
 		TheFramePacer->setFramesPerSecondLimit(TheGlobalData->m_framesPerSecondLimit);
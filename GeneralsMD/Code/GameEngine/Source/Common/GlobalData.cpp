@@ -391,6 +391,7 @@ GlobalData* GlobalData::m_theOriginal = nullptr;
 
 	{ "MaxLineBuildObjects",				INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxLineBuildObjects ) },
 	{ "MaxTunnelCapacity",					INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxTunnelCapacity ) },
+	{ "PathfindMaxBudgetScale",			INI::parseInt,				nullptr,			offsetof( GlobalData, m_pathfindMaxBudgetScale ) },
 
 	{ "MaxParticleCount",						INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxParticleCount ) },
 	{ "MaxFieldParticleCount",						INI::parseInt,				nullptr,			offsetof( GlobalData, m_maxFieldParticleCount ) },
@@ -882,6 +883,7 @@ GlobalData::GlobalData()
 	m_commandCenterHealRange = 0.0f;
 	m_commandCenterHealAmount = 0.0f;
 	m_maxTunnelCapacity = 0;
+	m_pathfindMaxBudgetScale = 1;
 	m_maxLineBuildObjects = 0;
 
 	m_standardMinefieldDensity = 0.01f;
@@ -984,11 +986,22 @@ GlobalData::GlobalData()
 	setTimeOfDay( m_timeOfDay );
 
 	m_buildMapCache = FALSE;
+	m_useINICache = FALSE;
 	m_initialFile.clear();
 	m_pendingFile.clear();
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplayResultsFile.clear();
+	m_simulateReplaysPerJob = 1;
+	m_simulateReplaySnapshotDir.clear();
+	m_simulateReplaySnapshotInterval = 100;
+	m_simulateReplaySnapshotFrame = 0;
+	m_memoryPoolTelemetryFile.clear();
+	m_memoryPoolTelemetryInterval = 10 * LOGICFRAMES_PER_SECOND;
+	m_incrementalLogicCRC = FALSE;
+	m_validateIncrementalLogicCRC = FALSE;
+	m_verifyScriptSchedule = FALSE;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
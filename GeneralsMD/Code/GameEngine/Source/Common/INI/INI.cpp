@@ -39,6 +39,7 @@
 #include "Common/file.h"
 #include "Common/FileSystem.h"
 #include "Common/GameAudio.h"
+#include "Common/INICache.h"
 #include "Common/Science.h"
 #include "Common/SpecialPower.h"
 #include "Common/ThingFactory.h"
@@ -196,6 +197,10 @@ INI::INI( void )
 	m_blockEndToken			= "END";
 	m_endOfFile					= FALSE;
 	m_buffer[0]					= 0;
+	m_cachedLineNext		= nullptr;
+	m_cachedLineEnd			= nullptr;
+	m_recordLines				= FALSE;
+	m_recordedLineCount	= 0;
 #ifdef DEBUG_CRASHING
 	m_curBlockStart[0]	= 0;
 #endif
@@ -414,7 +419,7 @@ UnsignedInt INI::loadDirectory(AsciiString dirName, INILoadType loadType, Xfer*
 void INI::prepFile( AsciiString filename, INILoadType loadType )
 {
 	// if we have a file open already -- we can't do another one
-	if( m_file != nullptr )
+	if( m_file != nullptr || m_cachedLineNext != nullptr )
 	{
 
 		DEBUG_CRASH(( "INI::load, cannot open file '%s', file already open", filename.str() ));
@@ -422,6 +427,23 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 
 	}
 
+	// TheSuperHackers @performance Serve the file from TheINICache if it is unchanged since it was cached,
+	// otherwise read it and keep its lines for the cache. Include loads are not cached.
+	if( TheINICache != nullptr && loadType != INI_LOAD_INCLUDE )
+	{
+		const INICache::Entry *entry = TheINICache->find( filename );
+		if( entry != nullptr )
+		{
+			m_cachedLineNext = &entry->lines[0];
+			m_cachedLineEnd = m_cachedLineNext + entry->lines.size();
+			m_filename = filename;
+			m_loadType = loadType;
+			return;
+		}
+
+		m_recordLines = INICache::isCacheable( filename );
+	}
+
 	// open the file
 	m_file = TheFileSystem->openFile(filename.str(), File::READ);
 	if( m_file == nullptr )
@@ -446,9 +468,17 @@ void INI::prepFile( AsciiString filename, INILoadType loadType )
 void INI::unPrepFile()
 {
 	// close the file
-	m_file->close();
-	m_file = nullptr;
+	if( m_file != nullptr )
+	{
+		m_file->close();
+		m_file = nullptr;
+	}
   m_readBufferUsed=m_readBufferNext=0;
+	m_cachedLineNext = nullptr;
+	m_cachedLineEnd = nullptr;
+	m_recordLines = FALSE;
+	m_recordedLines.clear();
+	m_recordedLineCount = 0;
 	m_filename = "None";
 	m_loadType = INI_LOAD_INVALID;
 	m_lineNum = 0;
@@ -457,33 +487,169 @@ void INI::unPrepFile()
 }
 
 //-------------------------------------------------------------------------------------------------
-static INIBlockParse findBlockParse(const char* token)
+// TheSuperHackers @performance Block and field tokens used to be found with a strcmp over the whole
+// parse table for every line of every INI file. Each table now gets a hashed token index on first
+// use, so a lookup is a single probe. Duplicate tokens still resolve to the first table entry.
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt hashParseToken(const char* token)
 {
-	for (const BlockParse* parse = theTypeTable; parse->token; ++parse)
+	// FNV-1a
+	UnsignedInt hash = 2166136261u;
+	for (; *token; ++token)
 	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			return parse->parse;
-		}
+		hash ^= (UnsignedByte)*token;
+		hash *= 16777619u;
 	}
-	return nullptr;
+	return hash;
 }
 
 //-------------------------------------------------------------------------------------------------
-static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
+class ParseTokenIndex
 {
-	const FieldParse* parse = parseTable;
-	for (; parse->token; ++parse)
+public:
+	ParseTokenIndex() : m_mask(0) {}
+
+	Bool isBuilt() const { return !m_slots.empty(); }
+
+	/// Index the tokens of a table terminated by an entry with a null token
+	template<typename ENTRY>
+	void build(const ENTRY* table)
 	{
-		if (strcmp( parse->token, token ) == 0)
+		Int count = 0;
+		while (table[count].token)
+			++count;
+
+		// Keep the load factor at or below one half
+		UnsignedInt size = 16;
+		while (size < (UnsignedInt)count * 2)
+			size <<= 1;
+
+		m_mask = size - 1;
+		m_slots.assign(size, Slot());
+
+		for (Int i = 0; i < count; ++i)
 		{
-			offset = parse->offset;
-			userData = parse->userData;
-			return parse->parse;
+			const char* token = table[i].token;
+			const UnsignedInt hash = hashParseToken(token);
+			UnsignedInt pos = hash & m_mask;
+			Bool duplicate = FALSE;
+
+			while (m_slots[pos].index >= 0)
+			{
+				if (m_slots[pos].hash == hash && strcmp(m_slots[pos].token, token) == 0)
+				{
+					duplicate = TRUE;
+					break;
+				}
+				pos = (pos + 1) & m_mask;
+			}
+
+			if (!duplicate)
+			{
+				m_slots[pos].token = token;
+				m_slots[pos].hash = hash;
+				m_slots[pos].index = i;
+			}
 		}
 	}
 
-	if (!parse->token && parse->parse)
+	/// Return the table index of the token, or -1 if the table has no such token
+	Int find(const char* token, UnsignedInt hash) const
+	{
+		UnsignedInt pos = hash & m_mask;
+		while (m_slots[pos].index >= 0)
+		{
+			if (m_slots[pos].hash == hash && strcmp(m_slots[pos].token, token) == 0)
+				return m_slots[pos].index;
+			pos = (pos + 1) & m_mask;
+		}
+		return -1;
+	}
+
+private:
+	struct Slot
+	{
+		const char* token;
+		UnsignedInt hash;
+		Int index;
+
+		Slot() : token(nullptr), hash(0), index(-1) {}
+	};
+
+	std::vector<Slot> m_slots;
+	UnsignedInt m_mask;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Token indices of every FieldParse table seen so far. All parse tables have static storage,
+	* so the table address identifies it for the lifetime of the program. */
+//-------------------------------------------------------------------------------------------------
+class FieldParseIndexCache
+{
+public:
+	~FieldParseIndexCache()
+	{
+		for (IndexMap::iterator it = m_indices.begin(); it != m_indices.end(); ++it)
+			delete it->second;
+	}
+
+	const ParseTokenIndex& get(const FieldParse* parseTable)
+	{
+		IndexMap::const_iterator it = m_indices.find(parseTable);
+		if (it != m_indices.end())
+			return *it->second;
+
+		ParseTokenIndex* index = new ParseTokenIndex;
+		index->build(parseTable);
+		m_indices[parseTable] = index;
+		return *index;
+	}
+
+private:
+	struct TableHash
+	{
+		size_t operator()(const FieldParse* parseTable) const { return (size_t)parseTable >> 4; }
+	};
+	struct TableEqual
+	{
+		Bool operator()(const FieldParse* a, const FieldParse* b) const { return a == b; }
+	};
+	typedef std::hash_map<const FieldParse*, ParseTokenIndex*, TableHash, TableEqual> IndexMap;
+
+	IndexMap m_indices;
+};
+
+static ParseTokenIndex s_blockParseIndex;
+static FieldParseIndexCache s_fieldParseIndexCache;
+
+//-------------------------------------------------------------------------------------------------
+static INIBlockParse findBlockParse(const char* token)
+{
+	if (!s_blockParseIndex.isBuilt())
+		s_blockParseIndex.build(theTypeTable);
+
+	Int index = s_blockParseIndex.find(token, hashParseToken(token));
+	return index >= 0 ? theTypeTable[index].parse : nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, UnsignedInt tokenHash, int& offset, const void*& userData)
+{
+	Int index = s_fieldParseIndexCache.get(parseTable).find(token, tokenHash);
+	if (index >= 0)
+	{
+		const FieldParse* parse = &parseTable[index];
+		offset = parse->offset;
+		userData = parse->userData;
+		return parse->parse;
+	}
+
+	// No match, so try the table's fallback entry, which is the terminator if it has a parse proc
+	const FieldParse* parse = parseTable;
+	while (parse->token)
+		++parse;
+
+	if (parse->parse)
 	{
 		offset = parse->offset;
 		userData = token;
@@ -559,6 +725,10 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 			}
 
 		}
+
+		// the whole file was read, so its lines can go into the cache
+		if( m_recordLines )
+			TheINICache->store( m_filename, m_recordedLines, m_recordedLineCount );
 	}
 	catch (...)
 	{
@@ -573,6 +743,36 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 	return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Read all lines of an INI file into TheINICache without parsing them. Files that already
+	* have a valid cache entry are left as they are. */
+//-------------------------------------------------------------------------------------------------
+UnsignedInt INI::cacheFile( AsciiString filename )
+{
+	DEBUG_ASSERTCRASH( TheINICache, ("INI::cacheFile, TheINICache is null") );
+
+	s_xfer = nullptr;
+	prepFile(filename, INI_LOAD_OVERWRITE);
+
+	try
+	{
+		while( m_endOfFile == FALSE )
+			readLine();
+
+		if( m_recordLines )
+			TheINICache->store( m_filename, m_recordedLines, m_recordedLineCount );
+	}
+	catch (...)
+	{
+		unPrepFile();
+		throw;
+	}
+
+	unPrepFile();
+
+	return 1;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Read a line from the already open file.  Any comments will be removed and
 	* therefore ignored from any given line */
@@ -580,10 +780,22 @@ UnsignedInt INI::load( AsciiString filename, INILoadType loadType, Xfer *pXfer )
 void INI::readLine( void )
 {
 	// sanity
-	DEBUG_ASSERTCRASH( m_file, ("readLine(), file pointer is null") );
+	DEBUG_ASSERTCRASH( m_file || m_cachedLineNext || m_endOfFile, ("readLine(), file pointer is null") );
 
   if (m_endOfFile)
     *m_buffer=0;
+  else if (m_cachedLineNext)
+  {
+    // TheSuperHackers @performance The cached line is already stripped and folded, just copy it
+    const size_t len = strlen(m_cachedLineNext);
+    memcpy(m_buffer, m_cachedLineNext, len + 1);
+    m_cachedLineNext += len + 1;
+
+    m_lineNum++;
+
+    if (m_cachedLineNext >= m_cachedLineEnd)
+      m_endOfFile = true;
+  }
   else
   {
     char *p=m_buffer;
@@ -651,6 +863,12 @@ void INI::readLine( void )
 														 INI_MAX_CHARS_PER_LINE) );
 
 		}
+
+		if (m_recordLines)
+		{
+			m_recordedLines.insert(m_recordedLines.end(), m_buffer, m_buffer + strlen(m_buffer) + 1);
+			++m_recordedLineCount;
+		}
   }
 
 	if (s_xfer)
@@ -1710,11 +1928,12 @@ void INI::initFromINIMulti( void *what, const MultiIniFieldParse& parseTableList
 			else
 			{
 				Bool found = false;
+				const UnsignedInt fieldHash = hashParseToken(field);
 				for (int ptIdx = 0; ptIdx < parseTableList.getCount(); ++ptIdx)
 				{
 					int offset = 0;
 					const void* userData = nullptr;
-					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, offset, userData);
+					INIFieldParseProc parse = findFieldParse(parseTableList.getNthFieldParse(ptIdx), field, fieldHash, offset, userData);
 					if (parse)
 					{
 						// parse this block and check for parse errors
@@ -0,0 +1,267 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: INICache.cpp /////////////////////////////////////////////////////////////////////////////
+// Desc:   Pre-tokenized cache of the INI files under Data\INI
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/INICache.h"
+
+#include "Common/crc.h"
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/INI.h"
+#include "Common/LocalFileSystem.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+INICache *TheINICache = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE DATA ///////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Cache file layout, all values are 32 bit little endian:
+//   header: magic, version, max chars per line, entry count
+//   entry:  name length, name, size high, size low, timestamp high, timestamp low,
+//           line count, line data length, line data CRC, line data
+static const UnsignedInt INI_CACHE_MAGIC = 0x43494E49; // "INIC"
+static const UnsignedInt INI_CACHE_VERSION = 1;
+
+//-------------------------------------------------------------------------------------------------
+static void writeUnsignedInt( File *file, UnsignedInt value )
+{
+	file->write( &value, sizeof( value ) );
+}
+
+//-------------------------------------------------------------------------------------------------
+static Bool readUnsignedInt( const char *&pos, const char *end, UnsignedInt &value )
+{
+	if( end - pos < (Int)sizeof( value ) )
+		return FALSE;
+
+	memcpy( &value, pos, sizeof( value ) );
+	pos += sizeof( value );
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt computeLinesCRC( const std::vector<char>& lines )
+{
+	CRC crc;
+	if( !lines.empty() )
+		crc.computeCRC( &lines[0], (Int)lines.size() );
+	return crc.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+INICache::INICache() : m_dirty( FALSE )
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INICache::isCacheable( const AsciiString& filename )
+{
+	return filename.startsWithNoCase( "Data\\INI\\" ) || filename.startsWithNoCase( "Data/INI/" );
+}
+
+//-------------------------------------------------------------------------------------------------
+AsciiString INICache::makeKey( const AsciiString& filename )
+{
+	AsciiString key;
+	for( const char *c = filename.str(); *c; ++c )
+		key.concat( *c == '/' ? '\\' : *c );
+
+	key.toLower();
+	return key;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INICache::load( const char *cacheFilename )
+{
+	m_entries.clear();
+	m_dirty = FALSE;
+
+	File *file = TheLocalFileSystem->openFile( cacheFilename, File::READ | File::BINARY );
+	if( file == nullptr )
+		return FALSE;
+
+	const Int fileSize = file->size();
+	char *data = file->readEntireAndClose();
+	if( data == nullptr )
+		return FALSE;
+
+	const char *pos = data;
+	const char *end = data + fileSize;
+	Bool ok = TRUE;
+
+	UnsignedInt magic = 0, version = 0, maxChars = 0, entryCount = 0;
+	if( !readUnsignedInt( pos, end, magic ) || magic != INI_CACHE_MAGIC
+		|| !readUnsignedInt( pos, end, version ) || version != INI_CACHE_VERSION
+		|| !readUnsignedInt( pos, end, maxChars ) || maxChars != INI_MAX_CHARS_PER_LINE
+		|| !readUnsignedInt( pos, end, entryCount ) )
+	{
+		ok = FALSE;
+	}
+
+	for( UnsignedInt i = 0; ok && i < entryCount; ++i )
+	{
+		UnsignedInt nameLength = 0;
+		if( !readUnsignedInt( pos, end, nameLength ) || end - pos < (Int)nameLength )
+		{
+			ok = FALSE;
+			break;
+		}
+
+		AsciiString name;
+		name.set( pos, nameLength );
+		pos += nameLength;
+
+		Entry entry;
+		UnsignedInt dataLength = 0, dataCRC = 0;
+		if( !readUnsignedInt( pos, end, (UnsignedInt&)entry.sizeHigh )
+			|| !readUnsignedInt( pos, end, (UnsignedInt&)entry.sizeLow )
+			|| !readUnsignedInt( pos, end, (UnsignedInt&)entry.timestampHigh )
+			|| !readUnsignedInt( pos, end, (UnsignedInt&)entry.timestampLow )
+			|| !readUnsignedInt( pos, end, entry.lineCount )
+			|| !readUnsignedInt( pos, end, dataLength )
+			|| !readUnsignedInt( pos, end, dataCRC )
+			|| end - pos < (Int)dataLength
+			|| entry.lineCount == 0 || dataLength == 0 || pos[dataLength - 1] != 0 )
+		{
+			ok = FALSE;
+			break;
+		}
+
+		entry.lines.assign( pos, pos + dataLength );
+		pos += dataLength;
+
+		if( computeLinesCRC( entry.lines ) != dataCRC )
+		{
+			ok = FALSE;
+			break;
+		}
+
+		m_entries[ name ] = entry;
+	}
+
+	delete [] data;
+
+	if( !ok )
+	{
+		DEBUG_LOG(( "INICache::load - '%s' is damaged or from another version, ignoring it", cacheFilename ));
+		m_entries.clear();
+		return FALSE;
+	}
+
+	DEBUG_LOG(( "INICache::load - read %d cached INI files from '%s'", (Int)m_entries.size(), cacheFilename ));
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool INICache::save( const char *cacheFilename )
+{
+	File *file = TheLocalFileSystem->openFile( cacheFilename, File::WRITE | File::CREATE | File::TRUNCATE | File::BINARY );
+	if( file == nullptr )
+	{
+		DEBUG_LOG(( "INICache::save - cannot write '%s'", cacheFilename ));
+		return FALSE;
+	}
+
+	writeUnsignedInt( file, INI_CACHE_MAGIC );
+	writeUnsignedInt( file, INI_CACHE_VERSION );
+	writeUnsignedInt( file, INI_MAX_CHARS_PER_LINE );
+	writeUnsignedInt( file, (UnsignedInt)m_entries.size() );
+
+	for( EntryMap::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it )
+	{
+		const AsciiString& name = it->first;
+		const Entry& entry = it->second;
+
+		writeUnsignedInt( file, name.getLength() );
+		file->write( name.str(), name.getLength() );
+		writeUnsignedInt( file, entry.sizeHigh );
+		writeUnsignedInt( file, entry.sizeLow );
+		writeUnsignedInt( file, entry.timestampHigh );
+		writeUnsignedInt( file, entry.timestampLow );
+		writeUnsignedInt( file, entry.lineCount );
+		writeUnsignedInt( file, (UnsignedInt)entry.lines.size() );
+		writeUnsignedInt( file, computeLinesCRC( entry.lines ) );
+		file->write( &entry.lines[0], (Int)entry.lines.size() );
+	}
+
+	file->close();
+	m_dirty = FALSE;
+
+	DEBUG_LOG(( "INICache::save - wrote %d cached INI files to '%s'", (Int)m_entries.size(), cacheFilename ));
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+const INICache::Entry* INICache::find( const AsciiString& filename ) const
+{
+	if( m_entries.empty() || !isCacheable( filename ) )
+		return nullptr;
+
+	EntryMap::const_iterator it = m_entries.find( makeKey( filename ) );
+	if( it == m_entries.end() )
+		return nullptr;
+
+	FileInfo info;
+	if( !TheFileSystem->getFileInfo( filename, &info ) )
+		return nullptr;
+
+	const Entry& entry = it->second;
+	if( entry.sizeHigh != info.sizeHigh || entry.sizeLow != info.sizeLow
+		|| entry.timestampHigh != info.timestampHigh || entry.timestampLow != info.timestampLow )
+	{
+		return nullptr;
+	}
+
+	return &entry;
+}
+
+//-------------------------------------------------------------------------------------------------
+void INICache::store( const AsciiString& filename, const std::vector<char>& lines, UnsignedInt lineCount )
+{
+	if( lineCount == 0 || !isCacheable( filename ) )
+		return;
+
+	FileInfo info;
+	if( !TheFileSystem->getFileInfo( filename, &info ) )
+		return;
+
+	Entry& entry = m_entries[ makeKey( filename ) ];
+	entry.sizeHigh = info.sizeHigh;
+	entry.sizeLow = info.sizeLow;
+	entry.timestampHigh = info.timestampHigh;
+	entry.timestampLow = info.timestampLow;
+	entry.lineCount = lineCount;
+	entry.lines = lines;
+
+	m_dirty = TRUE;
+}
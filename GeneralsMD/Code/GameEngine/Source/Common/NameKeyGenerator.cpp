@@ -30,6 +30,8 @@
 
 #include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
 
+#include "Common/CriticalSection.h"
+
 // Public Data ////////////////////////////////////////////////////////////////////////////////////
 NameKeyGenerator *TheNameKeyGenerator = nullptr;  ///< name key gen. singleton
 
@@ -75,6 +77,10 @@ void NameKeyGenerator::reset()
 //-------------------------------------------------------------------------------------------------
 void NameKeyGenerator::freeSockets()
 {
+	ScopedCriticalSection scopedCriticalSection(TheNameKeyCriticalSection);
+
+	m_keyBuckets.clear();
+
 	for (Int i = 0; i < SOCKET_COUNT; ++i)
 	{
 		Bucket *next;
@@ -111,15 +117,15 @@ inline UnsignedInt calcHashForLowercaseString(const char* p)
 //-------------------------------------------------------------------------------------------------
 AsciiString NameKeyGenerator::keyToName(NameKeyType key)
 {
-	for (Int i = 0; i < SOCKET_COUNT; ++i)
-	{
-		for (Bucket *b = m_sockets[i]; b; b = b->m_nextInSocket)
-		{
-			if (key == b->m_key)
-				return b->m_nameString;
-		}
-	}
-	return AsciiString::TheEmptyString;
+	ScopedCriticalSection scopedCriticalSection(TheNameKeyCriticalSection);
+
+	const size_t index = (size_t)(UnsignedInt)key;
+	if (key == NAMEKEY_INVALID || index >= m_keyBuckets.size())
+		return AsciiString::TheEmptyString;
+
+	const Bucket *b = m_keyBuckets[index];
+	DEBUG_ASSERTCRASH(b != nullptr && b->m_key == key, ("NameKeyGenerator key index is out of sync for key %d", (Int)key));
+	return b->m_nameString;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -258,12 +264,20 @@ NameKeyType NameKeyGenerator::nameToLowercaseKeyImpl(const char* name)
 //-------------------------------------------------------------------------------------------------
 NameKeyType NameKeyGenerator::createNameKey(UnsignedInt hash, const AsciiString& name)
 {
+	ScopedCriticalSection scopedCriticalSection(TheNameKeyCriticalSection);
+
 	Bucket *b = newInstance(Bucket);
 	b->m_key = (NameKeyType)m_nextID++;
 	b->m_nameString = name;
 	b->m_nextInSocket = m_sockets[hash];
 	m_sockets[hash] = b;
 
+	// keys are handed out consecutively from 1, so the new key is always the next index
+	if (m_keyBuckets.empty())
+		m_keyBuckets.push_back(nullptr); // NAMEKEY_INVALID
+	DEBUG_ASSERTCRASH(m_keyBuckets.size() == (size_t)b->m_key, ("NameKeyGenerator key index is out of sync"));
+	m_keyBuckets.push_back(b);
+
 	NameKeyType result = b->m_key;
 
 #if defined(RTS_DEBUG)
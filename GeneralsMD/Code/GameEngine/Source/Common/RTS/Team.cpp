@@ -1326,6 +1326,7 @@ Team::Team(TeamPrototype *proto, TeamID id ) :
 	if (proto)
 	{
 		proto->prependTo_TeamInstanceList(this);
+		TheScriptEngine->notifyOfTeamChange(this);
 		if (!proto->getTemplateInfo()->m_scriptOnAllClear.isEmpty() ||
 				!proto->getTemplateInfo()->m_scriptOnEnemySighted.isEmpty())
 		{
@@ -1351,6 +1352,7 @@ Team::~Team()
 //	DEBUG_ASSERTCRASH(getFirstItemIn_TeamMemberList() == nullptr, ("Team still has members in existence"));
 
 	TheScriptEngine->notifyOfTeamDestruction(this);
+	TheScriptEngine->notifyOfTeamChange(this);
 
 	// Tell the players a team is going away.
 	Int i;
@@ -1512,6 +1514,17 @@ void Team::setTeamTargetObject(const Object *target)
 	}
 }
 
+// ------------------------------------------------------------------------
+void Team::setActive(void)
+{
+	if (!m_active) {
+		m_created = true;
+		m_active = true;
+		// Scripts find singleton teams only once they are active.
+		TheScriptEngine->notifyOfTeamChange(this);
+	}
+}
+
 // ------------------------------------------------------------------------
 Object *Team::getTeamTargetObject(void)
 {
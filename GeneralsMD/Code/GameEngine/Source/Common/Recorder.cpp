@@ -1034,9 +1034,13 @@ public:
 	void setSawCRCMismatch(void) { m_sawCRCMismatch = TRUE; }
 	Bool sawCRCMismatch(void) const { return m_sawCRCMismatch; }
 
+	void setMismatchFrame(Int frame) { if (m_mismatchFrame < 0) m_mismatchFrame = frame; }
+	Int getMismatchFrame(void) const { return m_mismatchFrame; }
+
 protected:
 
 	Bool m_sawCRCMismatch;
+	Int m_mismatchFrame;
 	Bool m_skippedOne;
 	std::list<UnsignedInt> m_data;
 	UnsignedInt m_localPlayer;
@@ -1047,6 +1051,7 @@ CRCInfo::CRCInfo(UnsignedInt localPlayer, Bool isMultiplayer)
 	m_localPlayer = localPlayer;
 	m_skippedOne = !isMultiplayer;
 	m_sawCRCMismatch = FALSE;
+	m_mismatchFrame = -1;
 }
 
 void CRCInfo::addCRC(UnsignedInt val)
@@ -1085,6 +1090,11 @@ Bool RecorderClass::sawCRCMismatch() const
 	return m_crcInfo->sawCRCMismatch();
 }
 
+Int RecorderClass::getCRCMismatchFrame() const
+{
+	return m_crcInfo->getMismatchFrame();
+}
+
 void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback)
 {
 	if (fromPlayback)
@@ -1132,6 +1142,7 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 
 			// Print Mismatch in case we are simulating replays from console.
 			printf("CRC Mismatch in Frame %d\n", mismatchFrame);
+			m_crcInfo->setMismatchFrame(mismatchFrame);
 
 			// TheSuperHackers @tweak Pause the game on mismatch.
 			// But not when a window with focus is opened, because that can make resuming difficult.
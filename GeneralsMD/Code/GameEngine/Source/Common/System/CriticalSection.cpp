@@ -32,6 +32,7 @@ CriticalSection *TheUnicodeStringCriticalSection = nullptr;
 CriticalSection *TheDmaCriticalSection = nullptr;
 CriticalSection *TheMemoryPoolCriticalSection = nullptr;
 CriticalSection *TheDebugLogCriticalSection = nullptr;
+CriticalSection *TheNameKeyCriticalSection = nullptr;
 
 #ifdef PERF_TIMERS
 PerfGather TheCritSecPerfGather("CritSec");
@@ -150,12 +150,36 @@ void SubsystemInterfaceList::removeSubsystem(SubsystemInterface* sys)
 	}
 #endif
 }
+#ifdef DUMP_PERF_STATS
+//-----------------------------------------------------------------------------
+// TheSuperHackers @performance Report how long each subsystem spends in init and in INI parsing
+static void logInitSubsystemTime(const AsciiString& name, __int64 startTime64, __int64 iniStartTime64)
+{
+	__int64 endTime64, freq64;
+	GetPrecisionTimerTicksPerSec(&freq64);
+	GetPrecisionTimer(&endTime64);
+
+	const double initMs = (double)(iniStartTime64 - startTime64) * 1000.0 / (double)freq64;
+	const double iniMs = (double)(endTime64 - iniStartTime64) * 1000.0 / (double)freq64;
+	DEBUG_LOG(("initSubsystem %s: init %.2f ms, INI parse %.2f ms", name.str(), initMs, iniMs));
+}
+#endif
+
 //-----------------------------------------------------------------------------
 void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char* path1, const char* path2, Xfer *pXfer, AsciiString name, const char* objectFolderFileExtension)
 {
+#ifdef DUMP_PERF_STATS
+	__int64 startTime64, iniStartTime64;
+	GetPrecisionTimer(&startTime64);
+#endif
+
 	sys->setName(name);
 	sys->init();
 
+#ifdef DUMP_PERF_STATS
+	GetPrecisionTimer(&iniStartTime64);
+#endif
+
 	INI ini;
 	if (path1)
 		ini.loadFileDirectory(path1, INI_LOAD_OVERWRITE, pXfer );
@@ -164,14 +188,27 @@ void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char*
 	if (objectFolderFileExtension)
 		ini.loadDirectory( AsciiString( "Data\\INI\\Object" ), AsciiString(objectFolderFileExtension), INI_LOAD_MULTIFILE, pXfer,true);
 	m_subsystems.push_back(sys);
+
+#ifdef DUMP_PERF_STATS
+	logInitSubsystemTime(name, startTime64, iniStartTime64);
+#endif
 }
 
 //-----------------------------------------------------------------------------
 void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char* path1, const char* path2, Xfer *pXfer, AsciiString name, const AsciiStringVec& objectFolderFileExtensions)
 {
+#ifdef DUMP_PERF_STATS
+	__int64 startTime64, iniStartTime64;
+	GetPrecisionTimer(&startTime64);
+#endif
+
 	sys->setName(name);
 	sys->init();
 
+#ifdef DUMP_PERF_STATS
+	GetPrecisionTimer(&iniStartTime64);
+#endif
+
 	INI ini;
 	if (path1)
 		ini.loadFileDirectory(path1, INI_LOAD_OVERWRITE, pXfer );
@@ -188,6 +225,10 @@ void SubsystemInterfaceList::initSubsystem(SubsystemInterface* sys, const char*
 	}
 	
 	m_subsystems.push_back(sys);
+
+#ifdef DUMP_PERF_STATS
+	logInitSubsystemTime(name, startTime64, iniStartTime64);
+#endif
 }
 
 //-----------------------------------------------------------------------------
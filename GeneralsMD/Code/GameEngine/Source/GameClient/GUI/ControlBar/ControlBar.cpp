@@ -1636,17 +1636,17 @@ UnsignedInt CommandButton::getCostOfExecution(const Player* player, const Object
 			if (componentName.isEmpty())
 			{
 				// Calculate cost for all damaged components
-				std::vector<Component> components = body->getComponents();
-				for (std::vector<Component>::const_iterator it = components.begin();
+				const std::vector<Component*>& components = body->getComponents();
+				for (std::vector<Component*>::const_iterator it = components.begin();
 					 it != components.end(); ++it)
 				{
-					const Component& component = *it;
-					if (component.getReplacementCost() > 0)
+					const Component* component = *it;
+					if (component->getReplacementCost() > 0)
 					{
 						// Only include cost if component is damaged
-						if (component.getCurrentHealth() < component.getCurrentMaxHealth())
+						if (component->getCurrentHealth() < component->getCurrentMaxHealth())
 						{
-							totalCost += component.getReplacementCost();
+							totalCost += component->getReplacementCost();
 						}
 					}
 				}
@@ -60,6 +60,30 @@
 // the singleton
 ParticleSystemManager *TheParticleSystemManager = nullptr;
 
+#ifdef DUMP_PERF_STATS
+static UnsignedInt s_particlesUpdatedThisFrame = 0;
+static Int64 s_particleUpdateTimeThisFrame = 0;
+#endif
+
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Everything a Particle::update needs from its ParticleSystem.
+	* ParticleSystem::update fills this in once per frame before it walks its particles, so the
+	* particles no longer ask their system for drift, shader and wind values one at a time, and
+	* the wind origin (which can need an Object or Drawable lookup) is found once per system
+	* instead of once per particle. */
+// ------------------------------------------------------------------------------------------------
+struct ParticleUpdateInfo
+{
+	UnsignedInt m_frame;											///< current client frame
+	Coord3D m_driftVelocity;									///< drift velocity of the system
+	Real m_gravity;														///< gravity of the system
+	Int m_shaderType;													///< ParticleSystemInfo::ParticleShaderType of the system
+	Bool m_doWindMotion;											///< if false, the wind values below are not set
+	Coord3D m_windOrigin;											///< world position the wind force is measured from
+	Real m_windCos;														///< Cos of the wind angle
+	Real m_windSin;														///< Sin of the wind angle
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -345,8 +369,12 @@ void Particle::applyForce( const Coord3D *force )
 // ------------------------------------------------------------------------------------------------
 /** Update the behavior of an individual particle */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::update( void )
+Bool Particle::update( const ParticleUpdateInfo &info )
 {
+	// apply 'gravity' force
+	if (info.m_gravity != 0.0f)
+		m_accel.z += info.m_gravity;
+
 	// integrate acceleration into velocity
 	m_vel.x += m_accel.x;
 	m_vel.y += m_accel.y;
@@ -357,17 +385,13 @@ Bool Particle::update( void )
 	m_vel.z *= m_velDamping;
 
 	// integrate velocity into position
-	const Coord3D *driftVel = m_system->getDriftVelocity();
-	m_pos.x += m_vel.x + driftVel->x;
-	m_pos.y += m_vel.y + driftVel->y;
-	m_pos.z += m_vel.z + driftVel->z;
+	m_pos.x += m_vel.x + info.m_driftVelocity.x;
+	m_pos.y += m_vel.y + info.m_driftVelocity.y;
+	m_pos.z += m_vel.z + info.m_driftVelocity.z;
 
 	// integrate the wind (if specified) into position
-	ParticleSystemInfo::WindMotion windMotion = m_system->getWindMotion();
-
-	// see if we should even do anything
-	if( windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
-		doWindMotion();
+	if( info.m_doWindMotion )
+		doWindMotion( info );
 
 	// update orientation
 	m_angleZ += m_angularRateZ;
@@ -392,13 +416,13 @@ Bool Particle::update( void )
 	// Update alpha (if used)
 	//
 
-	if (m_system->getShaderType() != ParticleSystemInfo::ADDITIVE)
+	if (info.m_shaderType != ParticleSystemInfo::ADDITIVE)
 	{
 		m_alpha += m_alphaRate;
 
 		if (m_alphaTargetKey < MAX_KEYFRAMES && m_alphaKey[ m_alphaTargetKey ].frame)
 		{
-			if (TheGameClient->getFrame() - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
+			if (info.m_frame - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
 			{
 				m_alpha = m_alphaKey[ m_alphaTargetKey ].value;
 				m_alphaTargetKey++;
@@ -424,7 +448,7 @@ Bool Particle::update( void )
 
 	if (m_colorTargetKey < MAX_KEYFRAMES && m_colorKey[ m_colorTargetKey ].frame)
 	{
-		if (TheGameClient->getFrame() - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
+		if (info.m_frame - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
 		{
 			// can't set, because of colorscale
 			// m_color = m_colorKey[ m_colorTargetKey ].color;
@@ -470,7 +494,7 @@ Bool Particle::update( void )
 	DEBUG_ASSERTCRASH( m_lifetimeLeft, ( "A particle has an infinite lifetime..." ));
 
 	// if we've gone totally invisible, destroy ourselves
-	if (isInvisible())
+	if (isInvisible(info.m_shaderType))
 		return false;
 	return true;
 }
@@ -478,56 +502,17 @@ Bool Particle::update( void )
 // ------------------------------------------------------------------------------------------------
 /** Do wind motion as specified by the particle system template, if present */
 // ------------------------------------------------------------------------------------------------
-void Particle::doWindMotion( void )
+void Particle::doWindMotion( const ParticleUpdateInfo &info )
 {
 
-	// get the angle of the wind
-	Real windAngle = m_system->getWindAngle();
-
-	// get the system position
-	Coord3D systemPos;
-	m_system->getPosition( &systemPos );
-
-	// when we're attached objects and drawables we offset by that position as well
-	if( ObjectID attachedObj = m_system->getAttachedObject() )
-	{
-		Object *obj = TheGameLogic->findObjectByID( attachedObj );
-
-		if( obj )
-		{
-			const Coord3D *objPos = obj->getPosition();
-
-			systemPos.x += objPos->x;
-			systemPos.y += objPos->y;
-			systemPos.z += objPos->z;
-
-		}
-
-	}
-	else if( DrawableID attachedDraw = m_system->getAttachedDrawable() )
-	{
-		Drawable *draw = TheGameClient->findDrawableByID( attachedDraw );
-
-		if( draw )
-		{
-			const Coord3D *drawPos = draw->getPosition();
-
-			systemPos.x += drawPos->x;
-			systemPos.y += drawPos->y;
-			systemPos.z += drawPos->z;
-
-		}
-
-	}
-
 	//
 	// compute a vector from the system position in the world to the particle ... we will use
 	// this to compute how much force we apply
 	//
 	Coord3D v;
-	v.x = m_pos.x - systemPos.x;
-	v.y = m_pos.y - systemPos.y;
-	v.z = m_pos.z - systemPos.z;
+	v.x = m_pos.x - info.m_windOrigin.x;
+	v.y = m_pos.y - info.m_windOrigin.y;
+	v.z = m_pos.z - info.m_windOrigin.z;
 
 	// distance amounts for full force from wind and no force at all
 	Real fullForceDistance = 75.0f;
@@ -550,8 +535,8 @@ void Particle::doWindMotion( void )
 																		(noForceDistance - fullForceDistance)));
 
 		// integrate the wind motion into the position
-		m_pos.x += (Cos( windAngle ) * windForceStrength);
-		m_pos.y += (Sin( windAngle ) * windForceStrength);
+		m_pos.x += (info.m_windCos * windForceStrength);
+		m_pos.y += (info.m_windSin * windForceStrength);
 
 	}
 
@@ -570,7 +555,15 @@ ParticlePriorityType Particle::getPriority( void )
 // ------------------------------------------------------------------------------------------------
 Bool Particle::isInvisible( void )
 {
-	switch (m_system->getShaderType())
+	return isInvisible(m_system->getShaderType());
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Return true if this particle is invisible when drawn with the given shader */
+// ------------------------------------------------------------------------------------------------
+Bool Particle::isInvisible( Int shaderType )
+{
+	switch (shaderType)
 	{
 		case ParticleSystemInfo::ADDITIVE:
 			// if color is black, this particle is invisible
@@ -1164,6 +1157,9 @@ ParticleSystem::ParticleSystem( const ParticleSystemTemplate *sysTemplate,
 	m_personalityStore = 0;
 	m_controlParticle = nullptr;
 
+	m_allSystemsNext = nullptr;
+	m_allSystemsPrev = nullptr;
+
 	TheParticleSystemManager->friend_addParticleSystem(this);
 
 	//DEBUG_ASSERTLOG(!(m_totalParticleSystemCount % 10 == 0), ( "TotalParticleSystemCount = %d", m_totalParticleSystemCount ));
@@ -2036,22 +2032,28 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	//
 	// Update all particles in the system
 	//
+	ParticleUpdateInfo updateInfo;
+	updateInfo.m_frame = TheGameClient->getFrame();
+	updateInfo.m_driftVelocity = m_driftVelocity;
+	updateInfo.m_gravity = m_gravity;
+	updateInfo.m_shaderType = m_shaderType;
+	updateInfo.m_doWindMotion = (m_windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED);
+	if (updateInfo.m_doWindMotion)
+	{
+		computeWindOrigin( &updateInfo.m_windOrigin );
+		updateInfo.m_windCos = Cos( m_windAngle );
+		updateInfo.m_windSin = Sin( m_windAngle );
+	}
+
+#ifdef DUMP_PERF_STATS
+	s_particlesUpdatedThisFrame += m_particleCount;
+#endif
+
 	Particle *p = m_systemParticlesHead;
 	Particle *oldParticle;
 	while (p)
 	{
-
-		// apply 'gravity' force
-		if (m_gravity != 0.0f)
-		{
-			Coord3D force;
-			force.x = 0.0f;
-			force.y = 0.0f;
-			force.z = m_gravity;
-			p->applyForce( &force );
-		}
-
-		if (p->update() == false)
+		if (p->update( updateInfo ) == false)
 		{
 			oldParticle = p;
 			p = p->m_systemNext;
@@ -2088,6 +2090,49 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Compute the world position the wind force of this system is measured from */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::computeWindOrigin( Coord3D *origin )
+{
+
+	// get the system position
+	getPosition( origin );
+
+	// when we're attached objects and drawables we offset by that position as well
+	if( m_attachedToObjectID )
+	{
+		Object *obj = TheGameLogic->findObjectByID( m_attachedToObjectID );
+
+		if( obj )
+		{
+			const Coord3D *objPos = obj->getPosition();
+
+			origin->x += objPos->x;
+			origin->y += objPos->y;
+			origin->z += objPos->z;
+
+		}
+
+	}
+	else if( m_attachedToDrawableID )
+	{
+		Drawable *draw = TheGameClient->findDrawableByID( m_attachedToDrawableID );
+
+		if( draw )
+		{
+			const Coord3D *drawPos = draw->getPosition();
+
+			origin->x += drawPos->x;
+			origin->y += drawPos->y;
+			origin->z += drawPos->z;
+
+		}
+
+	}
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Update the wind motion */
 // ------------------------------------------------------------------------------------------------
@@ -2395,7 +2440,10 @@ void ParticleSystem::xfer( Xfer *xfer )
 	ParticleSystemInfo::xfer( xfer );
 
 	// particle system ID
+	ParticleSystemID oldSystemID = m_systemID;
 	xfer->xferUser( &m_systemID, sizeof( ParticleSystemID ) );
+	if( m_systemID != oldSystemID )
+		TheParticleSystemManager->friend_changeParticleSystemID( this, oldSystemID );
 
 	// attached to drawable id
 	xfer->xferDrawableID( &m_attachedToDrawableID );
@@ -2817,6 +2865,9 @@ ParticleSystemManager::ParticleSystemManager( void )
 	m_fieldParticleCount = 0;
 	m_particleSystemCount = 0;
 
+	m_allParticleSystemsHead = nullptr;
+	m_allParticleSystemsTail = nullptr;
+
 	for( Int i = 0; i < NUM_PARTICLE_PRIORITIES; ++i )
 	{
 
@@ -2870,12 +2921,12 @@ void ParticleSystemManager::init( void )
 // ------------------------------------------------------------------------------------------------
 void ParticleSystemManager::reset( void )
 {
-	while (!m_allParticleSystemList.empty())
+	while (m_allParticleSystemsHead)
 	{
-		DEBUG_ASSERTCRASH(m_allParticleSystemList.front() != nullptr, ("ParticleSystemManager::reset: ParticleSystem is null"));
-		deleteInstance(m_allParticleSystemList.front());
+		deleteInstance(m_allParticleSystemsHead);
 	}
 	DEBUG_ASSERTCRASH(m_particleSystemCount == 0, ("ParticleSystemManager::reset: m_particleSystemCount is %u, not 0", m_particleSystemCount));
+	DEBUG_ASSERTCRASH(m_particleSystemIDMap.empty(), ("ParticleSystemManager::reset: m_particleSystemIDMap is not empty"));
 
 	// sanity, our lists must be empty!!
 	for( Int i = 0; i < NUM_PARTICLE_PRIORITIES; ++i )
@@ -2914,20 +2965,47 @@ void ParticleSystemManager::update( void )
 	// update the last logic frame.
 	m_lastLogicFrameUpdate = TheGameLogic->getFrame();
 
+#ifdef DUMP_PERF_STATS
+	s_particlesUpdatedThisFrame = 0;
+	Int64 startTime64;
+	GetPrecisionTimer(&startTime64);
+#endif
+
 	//USE_PERF_TIMER(ParticleSystemManager)
-	ParticleSystemListIt it = m_allParticleSystemList.begin();
-	while( it != m_allParticleSystemList.end() )
+	ParticleSystem *sys = m_allParticleSystemsHead;
+	while( sys )
 	{
-		// TheSuperHackers @info Must increment the list iterator before potential element erasure from the list.
-		ParticleSystem* sys = *it++;
-		DEBUG_ASSERTCRASH(sys != nullptr, ("ParticleSystemManager::update: ParticleSystem is null"));
+		// TheSuperHackers @info Must advance to the next system before potential removal from the list.
+		ParticleSystem *nextSys = sys->m_allSystemsNext;
 
 		if (sys->update(m_localPlayerIndex) == false)
 		{
 			deleteInstance(sys);
 		}
+
+		sys = nextSys;
 	}
+
+#ifdef DUMP_PERF_STATS
+	Int64 endTime64;
+	GetPrecisionTimer(&endTime64);
+	s_particleUpdateTimeThisFrame = endTime64 - startTime64;
+#endif
+}
+
+#ifdef DUMP_PERF_STATS
+// ------------------------------------------------------------------------------------------------
+/** Get the number of particles updated and the time it took in the last update */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::getUpdateStats( UnsignedInt& particlesUpdatedThisFrame, double& updateTimeThisFrame )
+{
+	Int64 freq64;
+	GetPrecisionTimerTicksPerSec(&freq64);
+
+	particlesUpdatedThisFrame = s_particlesUpdatedThisFrame;
+	updateTimeThisFrame = (double)s_particleUpdateTimeThisFrame * 1000.0 / (double)freq64;
 }
+#endif
 
 // ------------------------------------------------------------------------------------------------
 /** sets the count of the particles on screen after each frame */
@@ -2968,23 +3046,19 @@ ParticleSystemID ParticleSystemManager::createAttachedParticleSystemID(
 // ------------------------------------------------------------------------------------------------
 /** Find a particle system with the matching system id  */
 // ------------------------------------------------------------------------------------------------
+DECLARE_PERF_TIMER(findParticleSystem)
 ParticleSystem *ParticleSystemManager::findParticleSystem( ParticleSystemID id )
 {
 	if (id == INVALID_PARTICLE_SYSTEM_ID)
 		return nullptr;	// my, that was easy
 
-	ParticleSystem *system = nullptr;
-
-	for( ParticleSystemListIt it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it ) {
-		system = *it;
-		DEBUG_ASSERTCRASH(system != nullptr, ("ParticleSystemManager::findParticleSystem: ParticleSystem is null"));
+	USE_PERF_TIMER(findParticleSystem)
 
-		if( system->getSystemID() == id ) {
-			return system;
-		}
-	}
+	ParticleSystemIDMap::const_iterator it = m_particleSystemIDMap.find( (UnsignedInt)id );
+	if( it == m_particleSystemIDMap.end() )
+		return nullptr;
 
-	return nullptr;
+	return it->second;
 
 }
 
@@ -3065,14 +3139,9 @@ void ParticleSystemManager::destroyAttachedSystems( Object *obj )
 		return;
 
 	// iterate through all systems
-	for( ParticleSystemListIt it = m_allParticleSystemList.begin();
-			 it != m_allParticleSystemList.end();
-			 ++it )
+	for( ParticleSystem *system = m_allParticleSystemsHead; system; system = system->m_allSystemsNext )
 	{
 
-		ParticleSystem *system = *it;
-		DEBUG_ASSERTCRASH(system != nullptr, ("ParticleSystemManager::destroyAttachedSystems: ParticleSystem is null"));
-
 		if( system->getAttachedObject() == obj->getID() )
 			system->destroy();
 
@@ -3148,7 +3217,23 @@ void ParticleSystemManager::removeParticle( Particle *particleToRemove)
 void ParticleSystemManager::friend_addParticleSystem( ParticleSystem *particleSystemToAdd )
 {
 	DEBUG_ASSERTCRASH(particleSystemToAdd != nullptr, ("ParticleSystemManager::friend_addParticleSystem: ParticleSystem is null"));
-	m_allParticleSystemList.push_back(particleSystemToAdd);
+
+	// append to the end of the list, retaining creation order
+	particleSystemToAdd->m_allSystemsNext = nullptr;
+	particleSystemToAdd->m_allSystemsPrev = m_allParticleSystemsTail;
+	if (m_allParticleSystemsTail)
+		m_allParticleSystemsTail->m_allSystemsNext = particleSystemToAdd;
+	else
+		m_allParticleSystemsHead = particleSystemToAdd;
+	m_allParticleSystemsTail = particleSystemToAdd;
+
+	// On an ID collision keep the system already indexed; the newcomer is still listed and updated,
+	// it just can't be found by ID.
+	std::pair<ParticleSystemIDMap::iterator, Bool> inserted =
+		m_particleSystemIDMap.insert(ParticleSystemIDMap::value_type((UnsignedInt)particleSystemToAdd->getSystemID(), particleSystemToAdd));
+	DEBUG_ASSERTCRASH(inserted.second,
+		("ParticleSystemManager::friend_addParticleSystem: ParticleSystem ID %d is already in use", (Int)particleSystemToAdd->getSystemID()));
+
 	++m_particleSystemCount;
 }
 
@@ -3157,13 +3242,42 @@ void ParticleSystemManager::friend_addParticleSystem( ParticleSystem *particleSy
 // ------------------------------------------------------------------------------------------------
 void ParticleSystemManager::friend_removeParticleSystem( ParticleSystem *particleSystemToRemove )
 {
-	ParticleSystemListIt it = std::find(m_allParticleSystemList.begin(), m_allParticleSystemList.end(), particleSystemToRemove);
-	if (it != m_allParticleSystemList.end()) {
-		m_allParticleSystemList.erase(it);
-		--m_particleSystemCount;
-	} else {
+	// Only drop the ID entry if it is ours, but always unlink, or the list would keep a dead system.
+	ParticleSystemIDMap::iterator it = m_particleSystemIDMap.find((UnsignedInt)particleSystemToRemove->getSystemID());
+	if (it != m_particleSystemIDMap.end() && it->second == particleSystemToRemove)
+		m_particleSystemIDMap.erase(it);
+	else
 		DEBUG_CRASH(("ParticleSystemManager::friend_removeParticleSystem: ParticleSystem to remove was not recognized"));
-	}
+
+	if (particleSystemToRemove->m_allSystemsNext)
+		particleSystemToRemove->m_allSystemsNext->m_allSystemsPrev = particleSystemToRemove->m_allSystemsPrev;
+	else
+		m_allParticleSystemsTail = particleSystemToRemove->m_allSystemsPrev;
+
+	if (particleSystemToRemove->m_allSystemsPrev)
+		particleSystemToRemove->m_allSystemsPrev->m_allSystemsNext = particleSystemToRemove->m_allSystemsNext;
+	else
+		m_allParticleSystemsHead = particleSystemToRemove->m_allSystemsNext;
+
+	particleSystemToRemove->m_allSystemsNext = particleSystemToRemove->m_allSystemsPrev = nullptr;
+	--m_particleSystemCount;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Re-index a particle system whose ID was changed by loading a save game. */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::friend_changeParticleSystemID( ParticleSystem *particleSystem, ParticleSystemID oldID )
+{
+	ParticleSystemIDMap::iterator it = m_particleSystemIDMap.find((UnsignedInt)oldID);
+	if (it != m_particleSystemIDMap.end() && it->second == particleSystem)
+		m_particleSystemIDMap.erase(it);
+	else
+		DEBUG_CRASH(("ParticleSystemManager::friend_changeParticleSystemID: ParticleSystem %d was not recognized", (Int)oldID));
+
+	std::pair<ParticleSystemIDMap::iterator, Bool> inserted =
+		m_particleSystemIDMap.insert(ParticleSystemIDMap::value_type((UnsignedInt)particleSystem->getSystemID(), particleSystem));
+	DEBUG_ASSERTCRASH(inserted.second,
+		("ParticleSystemManager::friend_changeParticleSystemID: ParticleSystem ID %d is already in use", (Int)particleSystem->getSystemID()));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -3247,12 +3361,9 @@ void ParticleSystemManager::xfer( Xfer *xfer )
 	{
 
 		// iterate each particle system
-		ParticleSystemListIt it;
-		for( it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it )
+		for( system = m_allParticleSystemsHead; system; system = system->m_allSystemsNext )
 		{
 			systemCount--;
-			// get system
-			system = *it;
 
 			// ignore destroyed systems and non-saveable systems
 			if( system->isDestroyed() == TRUE || system->isSaveable() == FALSE )	{
@@ -3342,8 +3453,7 @@ void ParticleSystemDebugDisplay( DebugDisplayInterface *dd, void *, FILE *fp )
 	dd->printf( "Total Particles (On Screen): %d\n", TheParticleSystemManager->getOnScreenParticleCount());
 	dd->printf( "Total Particle Systems: %d\n", TheParticleSystemManager->getParticleSystemCount() );
 
-	ParticleSystemManager::ParticleSystemList list = TheParticleSystemManager->getAllParticleSystems();
-	ParticleSystemManager::ParticleSystemList::iterator it;
+	ParticleSystem *sys;
 
 	std::map<AsciiString, Int> templateMap;
 	std::map<AsciiString, Int> templateMapParticleCount;
@@ -3351,14 +3461,14 @@ void ParticleSystemDebugDisplay( DebugDisplayInterface *dd, void *, FILE *fp )
 	std::map<AsciiString, Int>::iterator templateMapIt;
 	std::map<AsciiString, Int>::iterator templateMapParticleCountIt;
 
-	for ( it = list.begin(); it != list.end(); ++it )
+	for ( sys = TheParticleSystemManager->getFirstParticleSystem(); sys; sys = sys->getNextParticleSystem() )
 	{
-		AsciiString templateName = (*it)->getTemplate()->getName();
+		AsciiString templateName = sys->getTemplate()->getName();
 		templateMapIt = templateMap.find(templateName);
 		if (templateMapIt == templateMap.end())
 		{
 			templateMap.insert(std::make_pair(templateName, 1));
-			templateMapParticleCount.insert(std::make_pair(templateName, (*it)->getParticleCount()));
+			templateMapParticleCount.insert(std::make_pair(templateName, sys->getParticleCount()));
 		}
 		else
 		{
@@ -3366,7 +3476,7 @@ void ParticleSystemDebugDisplay( DebugDisplayInterface *dd, void *, FILE *fp )
 
 			templateMapParticleCountIt = templateMapParticleCount.find(templateName);
 			if (templateMapParticleCountIt != templateMapParticleCount.end())
-				templateMapParticleCountIt->second += (*it)->getParticleCount();
+				templateMapParticleCountIt->second += sys->getParticleCount();
 		}
 	}
 
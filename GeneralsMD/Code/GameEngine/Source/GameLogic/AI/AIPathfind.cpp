@@ -112,6 +112,9 @@ constexpr const UnsignedInt MAX_ADJUSTMENT_CELL_COUNT = 400;
 constexpr const UnsignedInt MAX_SAFE_PATH_CELL_COUNT = 2000;
 
 constexpr const UnsignedInt PATHFIND_CELLS_PER_FRAME = 5000; // Number of cells we will search pathfinding per frame.
+constexpr const Int PATHFIND_BACKLOG_PER_EXTRA_BUDGET = 32; // Every this many queued requests add another PATHFIND_CELLS_PER_FRAME, up to GlobalData::m_pathfindMaxBudgetScale.
+constexpr const Int PATHFIND_GOAL_FIELD_CELLS_PER_FRAME = 10000; // Cells a goal field build may reach per frame.
+constexpr const UnsignedInt PATHFIND_QUEUE_STAT_FRAMES = 300; // Frames between pathfind queue throughput reports.
 constexpr const UnsignedInt CELL_INFOS_TO_ALLOCATE = 30000;
 
 //-----------------------------------------------------------------------------------
@@ -1101,6 +1104,9 @@ Real Path::computeFlightDistToGoal( const Coord3D *pos, Coord3D& goalPos )
 
 PathfindCellInfo *PathfindCellInfo::s_infoArray = nullptr;
 PathfindCellInfo *PathfindCellInfo::s_firstFree = nullptr;
+PathfindCellInfo **PathfindCellInfo::s_openHeap = nullptr;
+Int PathfindCellInfo::s_openHeapCount = 0;
+UnsignedInt PathfindCellInfo::s_openSequence = 0;
 
 #if RETAIL_COMPATIBLE_PATHFINDING
 // TheSuperHackers @info This variable is here so the code will run down the retail compatible path till a failure mode is hit
@@ -1116,6 +1122,7 @@ void PathfindCellInfo::forceCleanPathFindCellInfos()
 		s_infoArray[i].m_open = FALSE;
 		s_infoArray[i].m_closed = FALSE;
 	}
+	openHeapClear();
 }
 
 void Pathfinder::forceCleanCells()
@@ -1143,11 +1150,17 @@ void PathfindCellInfo::allocateCellInfos(void)
 	s_infoArray = MSGNEW("PathfindCellInfo") PathfindCellInfo[CELL_INFOS_TO_ALLOCATE];	// pool[]ify
 	s_infoArray[CELL_INFOS_TO_ALLOCATE-1].m_pathParent = nullptr;
 	s_infoArray[CELL_INFOS_TO_ALLOCATE-1].m_isFree = true;
+	s_infoArray[CELL_INFOS_TO_ALLOCATE-1].m_openHeapIndex = -1;
 	s_firstFree = s_infoArray;
 	for (Int i=0; i<CELL_INFOS_TO_ALLOCATE-1; i++) {
 		s_infoArray[i].m_pathParent = &s_infoArray[i+1];
 		s_infoArray[i].m_isFree = true;
+		s_infoArray[i].m_openHeapIndex = -1;
 	}
+	// Only cells with an info can be open, so the heap can never hold more than the info pool.
+	s_openHeap = MSGNEW("PathfindCellInfo") PathfindCellInfo*[CELL_INFOS_TO_ALLOCATE];
+	s_openHeapCount = 0;
+	s_openSequence = 0;
 }
 
 /**
@@ -1168,6 +1181,9 @@ void PathfindCellInfo::releaseCellInfos(void)
 	delete[] s_infoArray;
 	s_infoArray = nullptr;
 	s_firstFree = nullptr;
+	delete[] s_openHeap;
+	s_openHeap = nullptr;
+	s_openHeapCount = 0;
 }
 
 /**
@@ -1188,6 +1204,8 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 		info->m_pathParent = nullptr;
 		info->m_costSoFar = 0;
 		info->m_totalCost = 0;
+		info->m_openHeapIndex = -1;
+		info->m_openSequence = 0;
 		info->m_open = 0;
 		info->m_closed = 0;
 		info->m_obstacleID = INVALID_ID;
@@ -1214,6 +1232,113 @@ void PathfindCellInfo::releaseACellInfo(PathfindCellInfo *theInfo)
 	s_firstFree->m_isFree = true;
 }
 
+/**
+ * Orders the open heap. Ties on total cost go to the cell that was opened first. This is close to,
+ * but not the same as, the original sorted open list, which is why the retail compatible
+ * pathfinding does not use the heap.
+ */
+Bool PathfindCellInfo::openHeapLess(const PathfindCellInfo *a, const PathfindCellInfo *b)
+{
+	if (a->m_totalCost != b->m_totalCost) {
+		return a->m_totalCost < b->m_totalCost;
+	}
+	return a->m_openSequence < b->m_openSequence;
+}
+
+/**
+ * Moves the heap entry at ndx up until its parent is cheaper.
+ */
+void PathfindCellInfo::openHeapSiftUp(Int ndx)
+{
+	PathfindCellInfo *info = s_openHeap[ndx];
+	while (ndx > 0) {
+		Int parent = (ndx-1)>>1;
+		if (!openHeapLess(info, s_openHeap[parent])) {
+			break;
+		}
+		s_openHeap[ndx] = s_openHeap[parent];
+		s_openHeap[ndx]->m_openHeapIndex = ndx;
+		ndx = parent;
+	}
+	s_openHeap[ndx] = info;
+	info->m_openHeapIndex = ndx;
+}
+
+/**
+ * Moves the heap entry at ndx down until both children are more expensive.
+ */
+void PathfindCellInfo::openHeapSiftDown(Int ndx)
+{
+	PathfindCellInfo *info = s_openHeap[ndx];
+	for (;;) {
+		Int child = 2*ndx+1;
+		if (child >= s_openHeapCount) {
+			break;
+		}
+		if (child+1 < s_openHeapCount && openHeapLess(s_openHeap[child+1], s_openHeap[child])) {
+			child++;
+		}
+		if (!openHeapLess(s_openHeap[child], info)) {
+			break;
+		}
+		s_openHeap[ndx] = s_openHeap[child];
+		s_openHeap[ndx]->m_openHeapIndex = ndx;
+		ndx = child;
+	}
+	s_openHeap[ndx] = info;
+	info->m_openHeapIndex = ndx;
+}
+
+/**
+ * Adds an info to the open heap.
+ */
+void PathfindCellInfo::openHeapPush(PathfindCellInfo *info)
+{
+	DEBUG_ASSERTCRASH(info->m_openHeapIndex<0, ("Already in the open heap."));
+	DEBUG_ASSERTCRASH(s_openHeapCount<CELL_INFOS_TO_ALLOCATE, ("Open heap overflow."));
+	info->m_openSequence = s_openSequence++;
+	s_openHeap[s_openHeapCount] = info;
+	openHeapSiftUp(s_openHeapCount++);
+}
+
+/**
+ * Removes an info from anywhere in the open heap.
+ */
+void PathfindCellInfo::openHeapRemove(PathfindCellInfo *info)
+{
+	Int ndx = info->m_openHeapIndex;
+	if (ndx < 0) {
+		return;
+	}
+	DEBUG_ASSERTCRASH(s_openHeap[ndx] == info, ("Bad open heap index."));
+	info->m_openHeapIndex = -1;
+	s_openHeapCount--;
+	if (ndx < s_openHeapCount) {
+		PathfindCellInfo *last = s_openHeap[s_openHeapCount];
+		s_openHeap[ndx] = last;
+		if (ndx > 0 && openHeapLess(last, s_openHeap[(ndx-1)>>1])) {
+			openHeapSiftUp(ndx);
+		} else {
+			openHeapSiftDown(ndx);
+		}
+	}
+	if (s_openHeapCount == 0) {
+		s_openSequence = 0;
+	}
+}
+
+/**
+ * Empties the open heap without touching the cells' open flags.
+ */
+void PathfindCellInfo::openHeapClear(void)
+{
+	for (Int i=0; i<s_openHeapCount; i++) {
+		s_openHeap[i]->m_openHeapIndex = -1;
+	}
+	s_openHeapCount = 0;
+	s_openSequence = 0;
+}
+
 //-----------------------------------------------------------------------------------
 
 /**
@@ -1556,6 +1681,86 @@ Bool PathfindCell::removeObstacle( Object *obstacle )
 
 /// put self on "open" list in ascending cost order, return new list
 PathfindCell *PathfindCell::putOnSortedOpenList( PathfindCell *list )
+{
+#if RETAIL_COMPATIBLE_PATHFINDING
+	// TheSuperHackers @info The heap breaks total cost ties in a different order than the original sorted list,
+	// which would change the paths and the CRC, so the retail compatible pathfinding keeps the sorted list.
+	if (!s_useFixedPathfinding)
+		return putOnSortedOpenListRetail(list);
+#endif
+	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
+	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==FALSE, ("Serious error - Invalid flags. jba"));
+	// TheSuperHackers @performance The open list is a binary heap, so insertion is O(log n) instead of a walk down a sorted list.
+	// The search start cell is assigned as the list head without being put on the list, so adopt it here.
+	if (list && list != this && list->m_info && list->m_info->m_openHeapIndex < 0 && !list->m_info->m_closed)
+	{
+		PathfindCellInfo::openHeapPush(list->m_info);
+	}
+	PathfindCellInfo::openHeapPush(m_info);
+
+	// mark newCell as being on open list
+	m_info->m_open = true;
+	m_info->m_closed = false;
+
+	return PathfindCellInfo::openHeapTop();
+}
+
+/// remove self from "open" list
+PathfindCell *PathfindCell::removeFromOpenList( PathfindCell *list )
+{
+#if RETAIL_COMPATIBLE_PATHFINDING
+	if (!s_useFixedPathfinding)
+		return removeFromOpenListRetail(list);
+#endif
+	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
+	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+	PathfindCellInfo::openHeapRemove(m_info);
+
+	m_info->m_open = false;
+	m_info->m_nextOpen = nullptr;
+	m_info->m_prevOpen = nullptr;
+
+	return PathfindCellInfo::openHeapTop();
+}
+
+/// remove all cells from "open" list
+Int PathfindCell::releaseOpenList( PathfindCell *list )
+{
+#if RETAIL_COMPATIBLE_PATHFINDING
+	if (!s_useFixedPathfinding)
+		return releaseOpenListRetail(list);
+#endif
+	Int count = 0;
+	// The search start cell may be the list head without being in the heap.
+	if (list && list->m_info && list->m_info->m_openHeapIndex < 0)
+	{
+		count++;
+		DEBUG_ASSERTCRASH(list->m_info->m_closed==FALSE, ("Serious error - Invalid flags. jba"));
+		list->m_info->m_open = FALSE;
+		list->releaseInfo();
+	}
+	while (PathfindCellInfo::s_openHeapCount > 0) {
+		count++;
+		PathfindCellInfo *curInfo = PathfindCellInfo::s_openHeap[PathfindCellInfo::s_openHeapCount-1];
+		PathfindCell *cur = curInfo->m_cell;
+		DEBUG_ASSERTCRASH(curInfo->m_closed==FALSE && curInfo->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+
+		// Pop from the back, so nothing needs to be re-sorted.
+		PathfindCellInfo::s_openHeapCount--;
+		curInfo->m_openHeapIndex = -1;
+		DEBUG_ASSERTCRASH(cur->m_info == curInfo, ("Bad backpointer in PathfindCellInfo"));
+		curInfo->m_nextOpen = nullptr;
+		curInfo->m_prevOpen = nullptr;
+		curInfo->m_open = FALSE;
+		cur->releaseInfo();
+	}
+	PathfindCellInfo::openHeapClear();
+	return count;
+}
+
+#if RETAIL_COMPATIBLE_PATHFINDING
+/// put self on the sorted "open" list in ascending cost order, return new list
+PathfindCell *PathfindCell::putOnSortedOpenListRetail( PathfindCell *list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==FALSE, ("Serious error - Invalid flags. jba"));
@@ -1569,7 +1774,6 @@ PathfindCell *PathfindCell::putOnSortedOpenList( PathfindCell *list )
 	{
 		// insertion sort
 		PathfindCell *c, *lastCell = nullptr;
-#if RETAIL_COMPATIBLE_PATHFINDING
 		// TheSuperHackers @bugfix In the retail compatible pathfinding, on rare occasions, we get stuck in an infinite loop
 		// External code should pickup on the bad behaviour and cleanup properly, but we need to explicitly break out here
 		// The fixed pathfinding does not have this issue due to the proper cleanup of pathfindCells and their pathfindCellInfos
@@ -1577,10 +1781,6 @@ PathfindCell *PathfindCell::putOnSortedOpenList( PathfindCell *list )
 		for (c = list; c && cellCount < PATHFIND_CELLS_PER_FRAME; c = c->getNextOpen())
 		{
 			cellCount++;
-#else
-		for (c = list; c; c = c->getNextOpen())
-		{
-#endif
 			if (c->m_info->m_totalCost > m_info->m_totalCost)
 				break;
 
@@ -1617,8 +1817,8 @@ PathfindCell *PathfindCell::putOnSortedOpenList( PathfindCell *list )
 	return list;
 }
 
-/// remove self from "open" list
-PathfindCell *PathfindCell::removeFromOpenList( PathfindCell *list )
+/// remove self from the sorted "open" list
+PathfindCell *PathfindCell::removeFromOpenListRetail( PathfindCell *list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
@@ -1637,8 +1837,8 @@ PathfindCell *PathfindCell::removeFromOpenList( PathfindCell *list )
 	return list;
 }
 
-/// remove all cells from "open" list
-Int PathfindCell::releaseOpenList( PathfindCell *list )
+/// remove all cells from the sorted "open" list
+Int PathfindCell::releaseOpenListRetail( PathfindCell *list )
 {
 	Int count = 0;
 	while (list) {
@@ -1648,7 +1848,6 @@ Int PathfindCell::releaseOpenList( PathfindCell *list )
 		PathfindCell *cur = list;
 		PathfindCellInfo *curInfo = list->m_info;
 
-#if RETAIL_COMPATIBLE_PATHFINDING
 		// TheSuperHackers @info This is only here to catch a crash point in the retail compatible pathfinding
 		// One crash mode is where a cell has no PathfindCellInfo, resulting in a nullptr access and a crash.
 		// Therefore we signal that we need to clean the maps cells and the PathfindCellInfos
@@ -1657,7 +1856,6 @@ Int PathfindCell::releaseOpenList( PathfindCell *list )
 			s_forceCleanCells = true;
 			return count;
 		}
-#endif
 
 		if (curInfo->m_nextOpen) {
 			list = curInfo->m_nextOpen->m_cell;
@@ -1672,6 +1870,7 @@ Int PathfindCell::releaseOpenList( PathfindCell *list )
 	}
 	return count;
 }
+#endif
 
 /// remove all cells from "closed" list
 Int PathfindCell::releaseClosedList( PathfindCell *list )
@@ -2044,7 +2243,9 @@ m_groundWaterZones(nullptr),
 m_groundRubbleZones(nullptr),
 m_crusherZones(nullptr),
 m_zonesAllocated(0),
-m_interactsWithBridge(FALSE)
+m_interactsWithBridge(FALSE),
+m_hasConnectLayerCells(FALSE),
+m_zonesDirty(TRUE)
 {
 	m_cellOrigin.x = 0;
 	m_cellOrigin.y = 0;
@@ -2141,6 +2342,86 @@ void ZoneBlock::blockCalculateZones(PathfindCell **map, PathfindLayer layers[],
 
 }
 
+/* TheSuperHackers @performance Labels the raw zones of the cells in this block.  A raw zone is a
+4-connected area of cells with the same type, and zones are numbered 1..n in the order of their first
+cell, which is the order the full calculation used to hand them out in.  Returns n. */
+Int ZoneBlock::blockLabelCells(PathfindCell **map, const IRegion2D &bounds)
+{
+	enum { MAX_BLOCK_CELLS = PathfindZoneManager::ZONE_BLOCK_SIZE*PathfindZoneManager::ZONE_BLOCK_SIZE };
+	static const Int neighborX[4] = { -1, 1, 0, 0 };
+	static const Int neighborY[4] = { 0, 0, -1, 1 };
+	ICoord2D toVisit[MAX_BLOCK_CELLS];
+	Int i, j;
+
+	m_hasConnectLayerCells = false;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			map[i][j].setZone(0);
+			if (map[i][j].getConnectLayer() > LAYER_GROUND) {
+				m_hasConnectLayerCells = true;
+			}
+		}
+	}
+
+	Int numZones = 0;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			if (map[i][j].getZone() != 0) continue;
+
+			// flood fill the new zone. every cell is pushed at most once.
+			++numZones;
+			PathfindCell::CellType type = map[i][j].getType();
+			map[i][j].setZone(numZones);
+			Int numToVisit = 0;
+			toVisit[numToVisit].x = i;
+			toVisit[numToVisit].y = j;
+			numToVisit++;
+			while (numToVisit > 0) {
+				ICoord2D cur = toVisit[--numToVisit];
+				for (Int n=0; n<4; n++) {
+					Int x = cur.x + neighborX[n];
+					Int y = cur.y + neighborY[n];
+					if (x<bounds.lo.x || x>bounds.hi.x || y<bounds.lo.y || y>bounds.hi.y) continue;
+					PathfindCell &neighbor = map[x][y];
+					if (neighbor.getZone() != 0 || neighbor.getType() != type) continue;
+					neighbor.setZone(numZones);
+					toVisit[numToVisit].x = x;
+					toVisit[numToVisit].y = y;
+					numToVisit++;
+				}
+			}
+		}
+	}
+	DEBUG_ASSERTCRASH(numZones <= 0xff, ("Too many zones in one block for the zone links."));
+	return numZones;
+}
+
+/* TheSuperHackers @performance Renumbers the zones of a block whose cells did not change, for when
+the blocks before it gained or lost zones.  The equivalency tables only depend on the relative zone
+numbers, so they shift along. */
+void ZoneBlock::blockShiftZones(PathfindCell **map, const IRegion2D &bounds, Int delta)
+{
+	if (delta == 0) return;
+
+	Int i, j;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			PathfindCell &cell = map[i][j];
+			cell.setZone(cell.getZone() + delta);
+		}
+	}
+
+	m_firstZone += delta;
+	if (m_numZones > 1) {
+		for (i=0; i<m_zonesAllocated; i++) {
+			m_groundCliffZones[i] += delta;
+			m_groundWaterZones[i] += delta;
+			m_groundRubbleZones[i] += delta;
+			m_crusherZones[i] += delta;
+		}
+	}
+}
+
 //
 // Return the zone at this location.
 //
@@ -2244,7 +2525,14 @@ m_crusherZones(nullptr),
 m_hierarchicalZones(nullptr),
 m_blockOfZoneBlocks(nullptr),
 m_zoneBlocks(nullptr),
-m_zonesAllocated(0)
+m_zonesAllocated(0),
+m_allZoneBlocksDirty(TRUE),
+m_mapChangeCount(0),
+m_fullZoneCalcCount(0),
+m_incrementalZoneCalcCount(0),
+m_incrementalZoneBlockCount(0),
+m_fullZoneCalcTime(0),
+m_incrementalZoneCalcTime(0)
 {
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
@@ -2330,23 +2618,199 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
 	}
+	m_allZoneBlocksDirty = true;
 }
 
 void PathfindZoneManager::reset(void)  ///< Called when the map is reset.
 {
 	freeZones();
 	freeBlocks();
+	m_allZoneBlocksDirty = true;
+	++m_mapChangeCount;
 }
 
 
-void PathfindZoneManager::markZonesDirty( Bool insert )  ///< Called when the zones need to be recalculated.
+/* TheSuperHackers @performance Min-root union find over a zone equivalency table.  Merging two zones
+always keeps the lower one like resolveZones does, so once flattened every zone maps to the lowest zone
+it is equivalent to, regardless of the order the zones were merged in. */
+static inline Int findZoneRoot(zoneStorageType *zoneEquivalency, Int zone)
+{
+	while (zoneEquivalency[zone] != zone) {
+		zoneEquivalency[zone] = zoneEquivalency[zoneEquivalency[zone]];
+		zone = zoneEquivalency[zone];
+	}
+	return zone;
+}
+
+static inline void linkZones(zoneStorageType *zoneEquivalency, Int zone1, Int zone2)
+{
+	zone1 = findZoneRoot(zoneEquivalency, zone1);
+	zone2 = findZoneRoot(zoneEquivalency, zone2);
+	if (zone1 < zone2) {
+		zoneEquivalency[zone2] = zone1;
+	} else if (zone2 < zone1) {
+		zoneEquivalency[zone1] = zone2;
+	}
+}
+
+static void flattenLinkedZones(zoneStorageType *zoneEquivalency, Int sizeOfZE)
 {
+	// roots are always lower than the zones linked to them, so a single pass suffices.
+	for (Int i=0; i<sizeOfZE; i++) {
+		zoneEquivalency[i] = zoneEquivalency[zoneEquivalency[i]];
+	}
+}
 
+void PathfindZoneManager::scheduleZoneCalculation(void)
+{
+	++m_mapChangeCount;
 	if (TheGameLogic->getFrame()<2) {
 		m_nextFrameToCalculateZones = 2;
 		return;
 	}
-    m_nextFrameToCalculateZones = MIN( m_nextFrameToCalculateZones, TheGameLogic->getFrame() + ZONE_UPDATE_FREQUENCY );
+	m_nextFrameToCalculateZones = MIN( m_nextFrameToCalculateZones, TheGameLogic->getFrame() + ZONE_UPDATE_FREQUENCY );
+}
+
+void PathfindZoneManager::markZonesDirty( Bool insert )  ///< Called when the zones need to be recalculated.
+{
+	m_allZoneBlocksDirty = true;
+	scheduleZoneCalculation();
+}
+
+/* TheSuperHackers @performance Only the zone blocks overlapping cellBounds get relabeled by the next
+zone calculation. */
+void PathfindZoneManager::markZonesDirty( Bool insert, const IRegion2D &cellBounds )
+{
+	if (m_zoneBlocks == nullptr) {
+		m_allZoneBlocksDirty = true;
+		scheduleZoneCalculation();
+		return;
+	}
+
+	if (cellBounds.lo.x > cellBounds.hi.x || cellBounds.lo.y > cellBounds.hi.y) {
+		scheduleZoneCalculation();
+		return;
+	}
+	Int loX = MAX(cellBounds.lo.x, 0) / ZONE_BLOCK_SIZE;
+	Int loY = MAX(cellBounds.lo.y, 0) / ZONE_BLOCK_SIZE;
+	Int hiX = MIN(cellBounds.hi.x / ZONE_BLOCK_SIZE, m_zoneBlockExtent.x-1);
+	Int hiY = MIN(cellBounds.hi.y / ZONE_BLOCK_SIZE, m_zoneBlockExtent.y-1);
+	for (Int xBlock=loX; xBlock<=hiX; xBlock++) {
+		for (Int yBlock=loY; yBlock<=hiY; yBlock++) {
+			m_zoneBlocks[xBlock][yBlock].m_zonesDirty = true;
+		}
+	}
+	scheduleZoneCalculation();
+}
+
+void PathfindZoneManager::getBlockBounds(Int xBlock, Int yBlock, const IRegion2D &globalBounds, IRegion2D &bounds) const
+{
+	bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
+	bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
+	bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
+	if (bounds.hi.x > globalBounds.hi.x) {
+		bounds.hi.x = globalBounds.hi.x;
+	}
+	if (bounds.hi.y > globalBounds.hi.y) {
+		bounds.hi.y = globalBounds.hi.y;
+	}
+}
+
+void ZoneBlock::addZoneLink(Int zone, Int other, Int otherZone, Int tables)
+{
+	if (tables == 0) return;
+
+	const Int numLinks = (Int)m_zoneLinks.size();
+	for (Int i=0; i<numLinks; i++) {
+		ZoneLink &link = m_zoneLinks[i];
+		if (link.m_zone == zone && link.m_other == other && link.m_otherZone == otherZone) {
+			link.m_tables |= tables;
+			return;
+		}
+	}
+	ZoneLink link;
+	link.m_zone = (UnsignedByte)zone;
+	link.m_otherZone = (UnsignedByte)otherZone;
+	link.m_other = (UnsignedByte)other;
+	link.m_tables = (UnsignedByte)tables;
+	m_zoneLinks.push_back(link);
+}
+
+/* TheSuperHackers @performance Collects the zone equivalencies a block contributes to the global tables,
+which are the ones the full scan finds when looking at a cell's connected layer and its left and top
+neighbors.  Only depends on this block's cells and the adjacent cells of the blocks left and above. */
+void PathfindZoneManager::collectZoneLinks(PathfindCell **map, Int xBlock, Int yBlock, const IRegion2D &bounds, const IRegion2D &globalBounds)
+{
+	ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+	block.m_zoneLinks.clear();
+
+	Int i, j;
+	for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+		for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+			const PathfindCell &r_thisCell = map[i][j];
+			const Int zone = r_thisCell.getZone() - block.m_firstZone;
+
+			if ( (r_thisCell.getConnectLayer() > LAYER_GROUND) &&
+				(r_thisCell.getType() == PathfindCell::CELL_CLEAR) )
+			{
+				block.addZoneLink(zone, ZoneBlock::ZONE_LINK_LAYER, r_thisCell.getConnectLayer(), ZoneBlock::ZONE_LINK_HIERARCHICAL);
+			}
+
+			if ( i > globalBounds.lo.x && r_thisCell.getZone() != map[i-1][j].getZone() )
+			{
+				const PathfindCell &r_leftCell = map[i-1][j];
+				Int tables = 0;
+				if (r_thisCell.getType() == r_leftCell.getType())
+					tables = ZoneBlock::ZONE_LINK_HIERARCHICAL;
+				else
+				{
+					if (terrain(r_thisCell, r_leftCell))
+						tables |= ZoneBlock::ZONE_LINK_TERRAIN;
+					if (crusherGround(r_thisCell, r_leftCell))
+						tables |= ZoneBlock::ZONE_LINK_CRUSHER;
+					if (tables == 0)
+					{
+						if (waterGround(r_thisCell, r_leftCell))
+							tables = ZoneBlock::ZONE_LINK_GROUND_WATER;
+						else if (groundRubble(r_thisCell, r_leftCell))
+							tables = ZoneBlock::ZONE_LINK_GROUND_RUBBLE;
+						else if (groundCliff(r_thisCell, r_leftCell))
+							tables = ZoneBlock::ZONE_LINK_GROUND_CLIFF;
+					}
+				}
+				if (i > bounds.lo.x)
+					block.addZoneLink(zone, ZoneBlock::ZONE_LINK_SELF, r_leftCell.getZone() - block.m_firstZone, tables);
+				else
+					block.addZoneLink(zone, ZoneBlock::ZONE_LINK_LEFT, r_leftCell.getZone() - m_zoneBlocks[xBlock-1][yBlock].m_firstZone, tables);
+			}
+
+			if ( j > globalBounds.lo.y && r_thisCell.getZone() != map[i][j-1].getZone() )
+			{
+				const PathfindCell &r_topCell = map[i][j-1];
+				Int tables = 0;
+				if (r_thisCell.getType() == r_topCell.getType())
+					tables = ZoneBlock::ZONE_LINK_HIERARCHICAL;
+				else
+				{
+					if (terrain(r_thisCell, r_topCell))
+						tables |= ZoneBlock::ZONE_LINK_TERRAIN;
+					if (crusherGround(r_thisCell, r_topCell))
+						tables |= ZoneBlock::ZONE_LINK_CRUSHER;
+					if (waterGround(r_thisCell, r_topCell))
+						tables |= ZoneBlock::ZONE_LINK_GROUND_WATER;
+					else if (groundRubble(r_thisCell, r_topCell))
+						tables |= ZoneBlock::ZONE_LINK_GROUND_RUBBLE;
+					else if (groundCliff(r_thisCell, r_topCell))
+						tables |= ZoneBlock::ZONE_LINK_GROUND_CLIFF;
+				}
+				if (j > bounds.lo.y)
+					block.addZoneLink(zone, ZoneBlock::ZONE_LINK_SELF, r_topCell.getZone() - block.m_firstZone, tables);
+				else
+					block.addZoneLink(zone, ZoneBlock::ZONE_LINK_TOP, r_topCell.getZone() - m_zoneBlocks[xBlock][yBlock-1].m_firstZone, tables);
+			}
+		}
+	}
 }
 
 /**
@@ -2362,7 +2826,7 @@ void PathfindZoneManager::markZonesDirty( Bool insert )  ///< Called when the zo
 static  Bool  s_stopForceCalling = FALSE;
 #endif
 
-void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer layers[], const IRegion2D &globalBounds )
+Bool PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer layers[], const IRegion2D &globalBounds )
 {
 
 #ifdef DEBUG_QPF
@@ -2377,112 +2841,60 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 #endif
 #endif
 
-	m_maxZone = 1;	// we start using zone 0 as a flag.
-	const Int maxZones=24000;
-	zoneStorageType zoneEquivalency[maxZones];
-	Int i, j;
-	for (i=0; i<maxZones; i++) {
-		zoneEquivalency[i] = i;
-	}
-	for (i=0; i<=LAYER_LAST; i++) {
-		layers[i].setZone(0);
-	}
+	// TheSuperHackers @performance Only the blocks whose cells changed since the last calculation are
+	// relabeled, the others are just renumbered.  Raw zones never cross block boundaries and every block
+	// numbers its zones consecutively in block order, so the result is identical to a full calculation.
+#if defined(PERF_TIMERS) || defined(DUMP_PERF_STATS)
+	Int64 calcStartTime64;
+	GetPrecisionTimer(&calcStartTime64);
+#endif
+	const Bool allBlocksDirty = m_allZoneBlocksDirty;
+	Int numRelabeledBlocks = 0;
 
+	Int i, j;
 	Int xCount = (globalBounds.hi.x-globalBounds.lo.x+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
 	Int yCount = (globalBounds.hi.y-globalBounds.lo.y+1+ZONE_BLOCK_SIZE-1)/ZONE_BLOCK_SIZE;
+	DEBUG_ASSERTCRASH(xCount == m_zoneBlockExtent.x && yCount == m_zoneBlockExtent.y, ("Zone blocks don't match the map."));
+
+	m_maxZone = 1;	// we start using zone 0 as a flag.
 
 	Int xBlock, yBlock;
 	for (xBlock = 0; xBlock<xCount; xBlock++) {
 		for (yBlock=0; yBlock<yCount; yBlock++) {
+			ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
 			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			if (bounds.hi.x > globalBounds.hi.x) {
-				bounds.hi.x = globalBounds.hi.x;
-			}
-			if (bounds.hi.y > globalBounds.hi.y) {
-				bounds.hi.y = globalBounds.hi.y;
-			}
-			m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(false);
-			for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
-				for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
-					PathfindCell *cell = &map[i][j];
-					cell->setZone(0);
-
-					if (i>bounds.lo.x) {
-						if (map[i][j].getType() == map[i-1][j].getType()) {
-							applyZone(map[i][j], map[i-1][j], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (j>bounds.lo.y) {
-						if (map[i][j].getType() == map[i][j-1].getType()) {
-							applyZone(map[i][j], map[i][j-1], zoneEquivalency, m_maxZone);
-						}
-					}
-					if (cell->getZone()==0) {
-						cell->setZone(m_maxZone);
-						m_maxZone++;
+			getBlockBounds(xBlock, yBlock, globalBounds, bounds);
+			if (allBlocksDirty || block.m_zonesDirty) {
+				block.m_zonesDirty = true; // so the blocks to the right and below recollect their links.
+				Int numZones = block.blockLabelCells(map, bounds);
+				Int offset = m_maxZone - 1;
+				for( j=bounds.lo.y; j<=bounds.hi.y; j++ )	{
+					for( i=bounds.lo.x; i<=bounds.hi.x; i++ )	{
+						PathfindCell &cell = map[i][j];
+						cell.setZone(cell.getZone() + offset);
 					}
-					if (cell->getConnectLayer() > LAYER_GROUND) {
- 						m_zoneBlocks[xBlock][yBlock].setInteractsWithBridge(true);
-					}
-
 				}
+				block.blockCalculateZones(map, layers, bounds);
+				m_maxZone += numZones;
+				++numRelabeledBlocks;
 			}
- 		}
-	}
-
-	Int totalZones = m_maxZone;
-
-	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
-	m_maxZone = 1;
-	Int collapsedZones[maxZones];
-	collapsedZones[0] = 0;
-
-  i = 1;
-  while ( i < totalZones )
-  {
-		Int zone = zoneEquivalency[ i ];
-		if (zone == i)
-    {
-			collapsedZones[ i ] = m_maxZone;
-			++m_maxZone;
-		}
-    else
-			collapsedZones[ i ] = collapsedZones[zone];
-
-    ++i;
-  }
-
-	// Now map the zones in the map back into the collapsed zones.
-	j=globalBounds.lo.y;
-  while( j<=globalBounds.hi.y )
-  {
-    i=globalBounds.lo.x;
-		while( i<=globalBounds.hi.x )
-    {
-      PathfindCell &cell = map[i][j];
-			cell.setZone(collapsedZones[cell.getZone()]);
-      ++i;
+			else
+			{
+				block.blockShiftZones(map, bounds, m_maxZone - block.m_firstZone);
+				m_maxZone += block.m_numZones;
+			}
+			block.setInteractsWithBridge(block.m_hasConnectLayerCells);
 		}
-    ++j;
 	}
 
+	// Each layer gets a zone of its own after the cell zones.
   i = 0;
 	while ( i <= LAYER_LAST )
   {
     PathfindLayer &r_thisLayer = layers[i];
 
-		Int zone = collapsedZones[r_thisLayer.getZone()];
-		if (zone == 0)
-    {
-			zone = m_maxZone;
-			m_maxZone++;
-		}
-
-    r_thisLayer.setZone( zone );
+    r_thisLayer.setZone( m_maxZone );
+		m_maxZone++;
     r_thisLayer.applyZone();
 
     if (!r_thisLayer.isUnused() && !r_thisLayer.isDestroyed())
@@ -2499,23 +2911,18 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 	allocateZones();
 
-	for (xBlock=0; xBlock<xCount; xBlock++)
-  {
-		for (yBlock=0; yBlock<yCount; yBlock++)
-    {
-			IRegion2D bounds;
-			bounds.lo.x = globalBounds.lo.x + xBlock*ZONE_BLOCK_SIZE;
-			bounds.lo.y = globalBounds.lo.y + yBlock*ZONE_BLOCK_SIZE;
-			bounds.hi.x = bounds.lo.x + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-			bounds.hi.y = bounds.lo.y + ZONE_BLOCK_SIZE - 1; // bounds are inclusive.
-
-      if (bounds.hi.x > globalBounds.hi.x)
-				bounds.hi.x = globalBounds.hi.x;
-
-      if (bounds.hi.y > globalBounds.hi.y)
-				bounds.hi.y = globalBounds.hi.y;
-
-			m_zoneBlocks[xBlock][yBlock].blockCalculateZones(map, layers, bounds);
+	// Recollect the equivalencies of the changed blocks and of the blocks bordering them to the right
+	// and below, as those look back across the block boundary.
+	for (xBlock=0; xBlock<xCount; xBlock++) {
+		for (yBlock=0; yBlock<yCount; yBlock++) {
+			Bool linksDirty = m_zoneBlocks[xBlock][yBlock].m_zonesDirty;
+			if (xBlock > 0 && m_zoneBlocks[xBlock-1][yBlock].m_zonesDirty) linksDirty = true;
+			if (yBlock > 0 && m_zoneBlocks[xBlock][yBlock-1].m_zonesDirty) linksDirty = true;
+			if (linksDirty) {
+				IRegion2D bounds;
+				getBlockBounds(xBlock, yBlock, globalBounds, bounds);
+				collectZoneLinks(map, xBlock, yBlock, bounds, globalBounds);
+			}
 		}
 	}
 
@@ -2526,96 +2933,45 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
     i++;
   }
 
-  REGISTER UnsignedInt maxZone = m_maxZone;
-	j=globalBounds.lo.y;
-  while( j <= globalBounds.hi.y )
-  {
-    i=globalBounds.lo.x;
-		while( i <= globalBounds.hi.x )
-    {
-      PathfindCell &r_thisCell = map[i][j];
-
-			if ( (r_thisCell.getConnectLayer() > LAYER_GROUND) &&
-				(r_thisCell.getType() == PathfindCell::CELL_CLEAR) )
-      {
-				PathfindLayer *layer = layers + r_thisCell.getConnectLayer();
-				resolveZones(r_thisCell.getZone(), layer->getZone(), m_hierarchicalZones, maxZone);
-			}
-
-			if ( i > globalBounds.lo.x && r_thisCell.getZone() != map[i-1][j].getZone() )
-      {
-        const PathfindCell &r_leftCell = map[i-1][j];
-
-				if (r_thisCell.getType() == r_leftCell.getType())
-					applyZone(r_thisCell, r_leftCell, m_hierarchicalZones, maxZone);//if this is true, skip all the ones below
-        else
-        {
-          Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
-
-          if (terrain(r_thisCell, r_leftCell))
-          {
-					  applyZone(r_thisCell, r_leftCell, m_terrainZones, maxZone);
-            notTerrainOrCrusher = FALSE;
-          }
-
-          if (crusherGround(r_thisCell, r_leftCell))
-          {
-					  applyZone(r_thisCell, r_leftCell, m_crusherZones, maxZone);
-            notTerrainOrCrusher = FALSE;
-          }
-
-          if ( notTerrainOrCrusher )
-          {
-            if (waterGround(r_thisCell, r_leftCell))
-					    applyZone(r_thisCell, r_leftCell, m_groundWaterZones, maxZone);
-            else if (groundRubble(r_thisCell, r_leftCell))
-					    applyZone(r_thisCell, r_leftCell, m_groundRubbleZones, maxZone);
-            else if (groundCliff(r_thisCell, r_leftCell))
-					    applyZone(r_thisCell, r_leftCell, m_groundCliffZones, maxZone);
-          }
-
-        }
-
-      }
-
-			if (j>globalBounds.lo.y && r_thisCell.getZone()!=map[i][j-1].getZone())
-      {
-        const PathfindCell &r_topCell = map[i][j-1];
-
-        if (r_thisCell.getType() == r_topCell.getType())
-					applyZone(r_thisCell, r_topCell, m_hierarchicalZones, maxZone);
-        else
-        {
-          Bool notTerrainOrCrusher = TRUE; // if this is false, skip the if-else-ladder below
-
-          if (terrain(r_thisCell, r_topCell))
-          {
-            applyZone(r_thisCell, r_topCell, m_terrainZones, maxZone);
-            notTerrainOrCrusher = FALSE;
-          }
-
-          if (crusherGround(r_thisCell, r_topCell))
-          {
-					  applyZone(r_thisCell, r_topCell, m_crusherZones, maxZone);
-            notTerrainOrCrusher = FALSE;
-          }
-
-          if (waterGround(r_thisCell,r_topCell))
-					  applyZone(r_thisCell, r_topCell, m_groundWaterZones, maxZone);
-          else if (groundRubble(r_thisCell, r_topCell))
-					  applyZone(r_thisCell, r_topCell, m_groundRubbleZones, maxZone);
-          else if (groundCliff(r_thisCell,r_topCell))
-					  applyZone(r_thisCell, r_topCell, m_groundCliffZones, maxZone);
-
-        }
-
-      }
-
-      ++i;
+	// Merging always keeps the lower zone, so the order the links are applied in does not matter.
+	for (xBlock=0; xBlock<xCount; xBlock++) {
+		for (yBlock=0; yBlock<yCount; yBlock++) {
+			ZoneBlock &block = m_zoneBlocks[xBlock][yBlock];
+			const Int numLinks = (Int)block.m_zoneLinks.size();
+			for (Int linkIndex = 0; linkIndex < numLinks; ++linkIndex) {
+				const ZoneBlock::ZoneLink &link = block.m_zoneLinks[linkIndex];
+				Int zone = block.m_firstZone + link.m_zone;
+				Int otherZone;
+				switch (link.m_other) {
+					case ZoneBlock::ZONE_LINK_LEFT: otherZone = m_zoneBlocks[xBlock-1][yBlock].m_firstZone + link.m_otherZone; break;
+					case ZoneBlock::ZONE_LINK_TOP: otherZone = m_zoneBlocks[xBlock][yBlock-1].m_firstZone + link.m_otherZone; break;
+					case ZoneBlock::ZONE_LINK_LAYER: otherZone = layers[link.m_otherZone].getZone(); break;
+					default: otherZone = block.m_firstZone + link.m_otherZone; break;
+				}
+				if (link.m_tables & ZoneBlock::ZONE_LINK_HIERARCHICAL) linkZones(m_hierarchicalZones, zone, otherZone);
+				if (link.m_tables & ZoneBlock::ZONE_LINK_TERRAIN) linkZones(m_terrainZones, zone, otherZone);
+				if (link.m_tables & ZoneBlock::ZONE_LINK_CRUSHER) linkZones(m_crusherZones, zone, otherZone);
+				if (link.m_tables & ZoneBlock::ZONE_LINK_GROUND_WATER) linkZones(m_groundWaterZones, zone, otherZone);
+				if (link.m_tables & ZoneBlock::ZONE_LINK_GROUND_RUBBLE) linkZones(m_groundRubbleZones, zone, otherZone);
+				if (link.m_tables & ZoneBlock::ZONE_LINK_GROUND_CLIFF) linkZones(m_groundCliffZones, zone, otherZone);
+			}
+		}
+	}
+
+	REGISTER UnsignedInt maxZone = m_maxZone;
+	flattenLinkedZones(m_hierarchicalZones, maxZone);
+	flattenLinkedZones(m_terrainZones, maxZone);
+	flattenLinkedZones(m_crusherZones, maxZone);
+	flattenLinkedZones(m_groundWaterZones, maxZone);
+	flattenLinkedZones(m_groundRubbleZones, maxZone);
+	flattenLinkedZones(m_groundCliffZones, maxZone);
+
+	for (xBlock=0; xBlock<xCount; xBlock++) {
+		for (yBlock=0; yBlock<yCount; yBlock++) {
+			m_zoneBlocks[xBlock][yBlock].m_zonesDirty = false;
 		}
-
-    ++j;
 	}
+	m_allZoneBlocksDirty = false;
 
   //FLATTEN HIERARCHICAL ZONES
   {
@@ -2685,7 +3041,37 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 		}
 	}
 #endif
+
+	Int64 calcTime64 = 0;
+#if defined(PERF_TIMERS) || defined(DUMP_PERF_STATS)
+	Int64 calcEndTime64;
+	GetPrecisionTimer(&calcEndTime64);
+	calcTime64 = calcEndTime64 - calcStartTime64;
+#endif
+	if (allBlocksDirty) {
+		++m_fullZoneCalcCount;
+		m_fullZoneCalcTime += calcTime64;
+	} else {
+		++m_incrementalZoneCalcCount;
+		m_incrementalZoneBlockCount += numRelabeledBlocks;
+		m_incrementalZoneCalcTime += calcTime64;
+	}
+#if defined(DEBUG_LOGGING)
+	if (!allBlocksDirty && (m_incrementalZoneCalcCount % 100) == 0) {
+		Int64 ticksPerSec = 1;
+#if defined(PERF_TIMERS) || defined(DUMP_PERF_STATS)
+		GetPrecisionTimerTicksPerSec(&ticksPerSec);
+#endif
+		const double ticksPerMs = (double)ticksPerSec / 1000.0;
+		DEBUG_LOG(("Zone calculations: %d full averaging %.3f ms, %d incremental averaging %.3f ms and %.1f of %d blocks.",
+			m_fullZoneCalcCount, m_fullZoneCalcCount ? (double)m_fullZoneCalcTime / ticksPerMs / m_fullZoneCalcCount : 0.0,
+			m_incrementalZoneCalcCount, (double)m_incrementalZoneCalcTime / ticksPerMs / m_incrementalZoneCalcCount,
+			(double)m_incrementalZoneBlockCount / m_incrementalZoneCalcCount, xCount*yCount));
+	}
+#endif
+
 	m_nextFrameToCalculateZones = 0xffffffff;
+	return !allBlocksDirty;
 }
 
 /**
@@ -3666,6 +4052,33 @@ void PathfindLayer::classifyWallMapCell( Int i, Int j , PathfindCell *cell, Obje
 	}
 }
 
+//----------------------- PathfindGoalField ---------------------------------------
+
+PathfindGoalField::PathfindGoalField() :
+m_costs(nullptr),
+m_height(0),
+m_zone(0),
+m_surfaces(0),
+m_mapChangeCount(0),
+m_searchedCost(0)
+{
+	m_extent.lo.x = m_extent.lo.y = m_extent.hi.x = m_extent.hi.y = 0;
+	m_goalCell.x = m_goalCell.y = 0;
+}
+
+PathfindGoalField::~PathfindGoalField()
+{
+	reset();
+}
+
+void PathfindGoalField::reset(void)
+{
+	delete [] m_costs;
+	m_costs = nullptr;
+	m_surfaces = 0;
+	m_searchedCost = 0;
+}
+
 //----------------------- Pathfinder ---------------------------------------
 
 Pathfinder::Pathfinder( void ) :m_map(nullptr)
@@ -3710,6 +4123,20 @@ void Pathfinder::reset( void )
 	// pathfind grid cells have not been classified yet
 	m_isMapReady = false;
 	m_cumulativeCellsAllocated = 0;
+	m_queueStatFrames = 0;
+	m_queueStatPaths = 0;
+	m_queueStatCells = 0;
+	m_queueStatMaxBacklog = 0;
+	m_queueStatMaxFrameCells = 0;
+	m_queueStatTimeMS = 0.0f;
+	m_queueStatMaxFrameTimeMS = 0.0f;
+	m_queueStatFieldsBuilt = 0;
+	m_queueStatFieldCells = 0;
+	m_queueStatFieldPaths = 0;
+
+	resetGoalFields();
+	m_activeGoalField = nullptr;
+	m_activeGoalFieldGoalCost = 0;
 
 	debugPathPos.x = 0.0f;
 	debugPathPos.y = 0.0f;
@@ -3843,6 +4270,20 @@ void Pathfinder::updateLayer(Object *obj, PathfindLayerEnum layer)
 	obj->setLayer(layer);
 }
 
+/* Grows bounds to include the changed cell, or starts them at it if it is the first one. */
+static inline void addChangedCell(IRegion2D &bounds, Bool hasCells, Int cx, Int cy)
+{
+	if (!hasCells) {
+		bounds.lo.x = bounds.hi.x = cx;
+		bounds.lo.y = bounds.hi.y = cy;
+		return;
+	}
+	if (bounds.lo.x>cx) bounds.lo.x = cx;
+	if (bounds.lo.y>cy) bounds.lo.y = cy;
+	if (bounds.hi.x<cx) bounds.hi.x = cx;
+	if (bounds.hi.y<cy) bounds.hi.y = cy;
+}
+
 /**
  * Classify the cells under the given object
  * If 'insert' is true, object is being added
@@ -3882,6 +4323,9 @@ void Pathfinder::classifyFence( Object *obj, Bool insert )
 	cellBounds.hi.y = REAL_TO_INT_CEIL((pos->y + 0.5f)/PATHFIND_CELL_SIZE_F);
 #endif
 	Bool didAnything = false;
+	IRegion2D changedBounds;
+	changedBounds.lo.x = changedBounds.lo.y = 0;
+	changedBounds.hi.x = changedBounds.hi.y = -1;
 
  	for (Int iy = 0; iy < numStepsY; ++iy, tl_x += ydx, tl_y += ydy)
  	{
@@ -3898,12 +4342,14 @@ void Pathfinder::classifyFence( Object *obj, Bool insert )
  					pos.x = cx;
  					pos.y = cy;
 					if (m_map[cx][cy].setTypeAsObstacle( obj, true, pos )) {
+						addChangedCell(changedBounds, didAnything, cx, cy);
 						didAnything = true;
  						m_map[cx][cy].setZone(PathfindZoneManager::UNINITIALIZED_ZONE);
 					}
  				}
 				else {
 					if (m_map[cx][cy].removeObstacle(obj)) {
+						addChangedCell(changedBounds, didAnything, cx, cy);
 						didAnything = true;
  						m_map[cx][cy].setZone(PathfindZoneManager::UNINITIALIZED_ZONE);
 					}
@@ -3916,7 +4362,7 @@ void Pathfinder::classifyFence( Object *obj, Bool insert )
  		}
  	}
 	if (didAnything) {
-		m_zoneManager.markZonesDirty( insert );
+		m_zoneManager.markZonesDirty( insert, changedBounds );
 		m_zoneManager.updateZonesForModify(m_map, m_layers, cellBounds, m_extent);
 	}
 }
@@ -3987,6 +4433,7 @@ void Pathfinder::classifyObjectFootprint( Object *obj, Bool insert )
 				}
 				// recalc the wall.
 				m_layers[LAYER_WALL].classifyWallCells(m_wallPieces, m_numWallPieces);
+				m_zoneManager.invalidateZoneBlocks(); // the wall connects to ground cells all over the map.
 			}
 		}
 	}
@@ -4020,8 +4467,6 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 	{
 		case GEOMETRY_BOX:
 		{
-			m_zoneManager.markZonesDirty( insert );
-
 			Real angle = obj->getOrientation();
 
 			Real halfsizeX = obj->getGeometryInfo().getMajorRadius();
@@ -4079,7 +4524,6 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 		case GEOMETRY_SPHERE:	// not quite right, but close enough
 		case GEOMETRY_CYLINDER:
 		{
-			m_zoneManager.markZonesDirty( insert );
 			// fill in all cells that overlap as obstacle cells
 			/// @todo This is a very inefficient circle-rasterizer
 			ICoord2D topLeft, bottomRight;
@@ -4212,6 +4656,10 @@ void Pathfinder::internal_classifyObjectFootprint( Object *obj, Bool insert )
 		}
 	}
 
+	// TheSuperHackers @performance Only the zone blocks touched by the footprint and the pinched cells
+	// around it need to be relabeled.
+	m_zoneManager.markZonesDirty( insert, cellBounds );
+
 	// Expand building bounds 1 cell.
 	for( j=cellBounds.lo.y; j<=cellBounds.hi.y; j++ )
 	{
@@ -4415,6 +4863,7 @@ void Pathfinder::classifyMap(void)
 	if (!m_layers[LAYER_WALL].isUnused()) {
 		m_layers[LAYER_WALL].classifyWallCells(m_wallPieces, m_numWallPieces);
 	}
+	m_zoneManager.invalidateZoneBlocks();
 	m_zoneManager.calculateZones(m_map, m_layers, m_extent);
 }
 
@@ -4446,8 +4895,18 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(nullptr, 0, 0, color);	 // erase.
 	}
 
-	for( s = m_openList; s; s=s->getNextOpen() )
+	for( Int i = 0; ; i++ )
 	{
+#if RETAIL_COMPATIBLE_PATHFINDING
+		// The retail compatible pathfinding keeps the open cells on the sorted list instead of the heap.
+		if (!s_useFixedPathfinding)
+			s = (i == 0) ? m_openList : s->getNextOpen();
+		else
+#endif
+		s = (i < PathfindCellInfo::getOpenHeapCount()) ? PathfindCellInfo::getOpenHeapCell(i) : nullptr;
+		if (s == nullptr)
+			break;
+
 		// create objects to show path - they decay
 		RGBColor color;
 		color.red = color.green = 0;
@@ -5603,8 +6062,17 @@ void Pathfinder::processPathfindQueue(void)
 #endif
     m_zoneManager.needToCalculateZones())
   {
-		m_zoneManager.calculateZones(m_map, m_layers, m_extent);
+		const Bool incremental = m_zoneManager.calculateZones(m_map, m_layers, m_extent);
+#if RETAIL_COMPATIBLE_CRC
+		(void)incremental;
 		return;
+#else
+		// TheSuperHackers @performance An incremental zone calculation is cheap enough to still serve the
+		// pathfind queue this frame.
+		if (!incremental) {
+			return;
+		}
+#endif
 	}
 
 	// Get the current logical extent.
@@ -5623,7 +6091,30 @@ void Pathfinder::processPathfindQueue(void)
 #ifdef DEBUG_QPF
 	Int pathsFound = 0;
 #endif
-	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME &&
+	const Int backlog = getQueuedPathfindRequestCount();
+	Int cellBudget = PATHFIND_CELLS_PER_FRAME;
+#if !RETAIL_COMPATIBLE_CRC
+	// TheSuperHackers @performance Serve a long queue with a larger cell budget, so large armies don't wait
+	// many frames for their paths. The worst case frame time grows by the same factor, so this is off unless
+	// GameData.ini raises PathfindMaxBudgetScale above 1. The requests are still served one by one in queue
+	// order, and both the backlog and the INI data are the same on all clients, so this stays deterministic.
+	Int budgetScale = 1 + backlog / PATHFIND_BACKLOG_PER_EXTRA_BUDGET;
+	if (budgetScale > TheGlobalData->m_pathfindMaxBudgetScale) {
+		budgetScale = TheGlobalData->m_pathfindMaxBudgetScale;
+	}
+	if (budgetScale > 1) {
+		cellBudget *= budgetScale;
+	}
+#endif
+#ifdef DEBUG_LOGGING
+	__int64 serveStartTime64;
+	QueryPerformanceCounter((LARGE_INTEGER *)&serveStartTime64);
+#endif
+#if !RETAIL_COMPATIBLE_CRC
+	continueGoalField(PATHFIND_GOAL_FIELD_CELLS_PER_FRAME);
+#endif
+	UnsignedInt pathsServed = 0;
+	while (m_cumulativeCellsAllocated < cellBudget &&
 		m_queuePRTail!=m_queuePRHead) {
 		Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[m_queuePRHead]);
 		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
@@ -5631,6 +6122,7 @@ void Pathfinder::processPathfindQueue(void)
 			AIUpdateInterface *ai = obj->getAIUpdateInterface();
 			if (ai) {
 				ai->doPathfind(this);
+				pathsServed++;
 #ifdef DEBUG_QPF
 				pathsFound++;
 #endif
@@ -5641,6 +6133,15 @@ void Pathfinder::processPathfindQueue(void)
 			m_queuePRHead = 0;
 		}
 	}
+#ifdef DEBUG_LOGGING
+	__int64 serveEndTime64, serveFreq64;
+	QueryPerformanceCounter((LARGE_INTEGER *)&serveEndTime64);
+	QueryPerformanceFrequency((LARGE_INTEGER *)&serveFreq64);
+	const Real serveTimeMS = (Real)((double)(serveEndTime64-serveStartTime64) * 1000.0 / (double)serveFreq64);
+#else
+	const Real serveTimeMS = 0.0f;
+#endif
+	updateQueueStats(backlog, pathsServed, serveTimeMS);
 	if (pathsFound>0) {
 #ifdef DEBUG_QPF
 #ifdef DEBUG_LOGGING
@@ -5648,7 +6149,8 @@ void Pathfinder::processPathfindQueue(void)
 		timeToUpdate = ((double)(endTime64-startTime64) / (double)(freq64));
 		if (timeToUpdate>0.01f)
 		{
-			DEBUG_LOG(("%d Pathfind queue: %d paths, %d cells --", TheGameLogic->getFrame(), pathsFound, m_cumulativeCellsAllocated));
+			DEBUG_LOG(("%d Pathfind queue: %d paths, %d cells, %.1f cells/ms --", TheGameLogic->getFrame(), pathsFound, m_cumulativeCellsAllocated,
+				m_cumulativeCellsAllocated / (timeToUpdate*1000.0)));
 			DEBUG_LOG(("time %f (%f)", timeToUpdate, (::GetTickCount()-startTimeMS)/1000.0f));
 		}
 #endif
@@ -5661,6 +6163,460 @@ void Pathfinder::processPathfindQueue(void)
 }
 
 
+/**
+ * Number of requests waiting in the pathfind queue.
+ */
+Int Pathfinder::getQueuedPathfindRequestCount(void) const
+{
+	Int count = m_queuePRTail - m_queuePRHead;
+	if (count < 0) {
+		count += PATHFIND_QUEUE_LEN;
+	}
+	return count;
+}
+
+/**
+ * Accumulates the pathfind queue throughput, and reports it every PATHFIND_QUEUE_STAT_FRAMES frames.
+ */
+void Pathfinder::updateQueueStats(Int backlog, UnsignedInt pathsServed, Real serveTimeMS)
+{
+	++m_queueStatFrames;
+	m_queueStatPaths += pathsServed;
+	m_queueStatCells += m_cumulativeCellsAllocated;
+	if (m_queueStatMaxBacklog < backlog) {
+		m_queueStatMaxBacklog = backlog;
+	}
+	if (m_queueStatMaxFrameCells < m_cumulativeCellsAllocated) {
+		m_queueStatMaxFrameCells = m_cumulativeCellsAllocated;
+	}
+	m_queueStatTimeMS += serveTimeMS;
+	if (m_queueStatMaxFrameTimeMS < serveTimeMS) {
+		m_queueStatMaxFrameTimeMS = serveTimeMS;
+	}
+	if (m_queueStatFrames < PATHFIND_QUEUE_STAT_FRAMES) {
+		return;
+	}
+	if (m_queueStatPaths > 0) {
+		DEBUG_LOG(("Pathfind queue: %.2f paths/frame, %.0f cells/frame (max %d), %.3f ms/frame (max %.3f), max backlog %d requests, budget scale up to %d.",
+			(Real)m_queueStatPaths / m_queueStatFrames, (Real)m_queueStatCells / m_queueStatFrames, m_queueStatMaxFrameCells,
+			m_queueStatTimeMS / m_queueStatFrames, m_queueStatMaxFrameTimeMS, m_queueStatMaxBacklog, TheGlobalData->m_pathfindMaxBudgetScale));
+	}
+	if (m_queueStatFieldsBuilt > 0) {
+		DEBUG_LOG(("Pathfind goal fields: %d built reaching %d cells, %d paths steered.",
+			m_queueStatFieldsBuilt, m_queueStatFieldCells, m_queueStatFieldPaths));
+	}
+	m_queueStatFrames = 0;
+	m_queueStatPaths = 0;
+	m_queueStatCells = 0;
+	m_queueStatMaxBacklog = 0;
+	m_queueStatMaxFrameCells = 0;
+	m_queueStatTimeMS = 0.0f;
+	m_queueStatMaxFrameTimeMS = 0.0f;
+	m_queueStatFieldsBuilt = 0;
+	m_queueStatFieldCells = 0;
+	m_queueStatFieldPaths = 0;
+}
+
+/**
+ * True if a goal field search may enter cell (x,y).  This is looser than validMovementPosition without
+ * crushing, as fences and bridges are let through for everyone, so the field never overestimates the cost
+ * of a path that doesn't crush or pass through obstacles.
+ */
+Bool Pathfinder::isGoalFieldCellPassable(LocomotorSurfaceTypeMask surfaces, Int x, Int y)
+{
+	PathfindCell *cell = getCell(LAYER_GROUND, x, y);
+	if (cell == nullptr) {
+		return false;
+	}
+	if (validLocomotorSurfacesForCellType(cell->getType()) & surfaces) {
+		return true;
+	}
+	if (cell->isObstacleFence()) {
+		return true;
+	}
+	for (Int layer = LAYER_GROUND+1; layer < LAYER_WALL; layer++) {
+		if (m_layers[layer].isUnused() || m_layers[layer].isDestroyed()) {
+			continue;
+		}
+		PathfindCell *bridgeCell = m_layers[layer].getCell(x, y);
+		if (bridgeCell && (validLocomotorSurfacesForCellType(bridgeCell->getType()) & surfaces)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * TheSuperHackers @performance Starts the goal field for a group moving from starts to goal, unless a
+ * current one for the same goal cell, zone and surfaces already reaches every start.  The Dijkstra
+ * search runs on a bucket queue, a slice of PATHFIND_GOAL_FIELD_CELLS_PER_FRAME cells per frame, and
+ * stops a little past the farthest start it can reach.
+ */
+void Pathfinder::buildGoalField(const Coord3D *goal, LocomotorSurfaceTypeMask surfaces,
+																const Coord3D *starts, Int numStarts)
+{
+	if (!m_isMapReady || numStarts < 1) {
+		return;
+	}
+	ICoord2D goalNdx;
+	if (worldToCell(goal, &goalNdx)) {
+		return; // off the map.
+	}
+	if (!isGoalFieldCellPassable(surfaces, goalNdx.x, goalNdx.y)) {
+		return; // the members will adjust their goals, and path without a field.
+	}
+	const zoneStorageType zone = m_zoneManager.getEffectiveZone(surfaces, false, m_map[goalNdx.x][goalNdx.y].getZone());
+	const UnsignedInt mapChangeCount = m_zoneManager.getMapChangeCount();
+
+	// Only the starts in the goal's zone can ever be reached.
+	std::vector<ICoord2D> pendingStarts;
+	pendingStarts.reserve(numStarts);
+	Int i;
+	for (i=0; i<numStarts; i++) {
+		ICoord2D ndx;
+		if (worldToCell(&starts[i], &ndx)) {
+			continue;
+		}
+		if (m_zoneManager.getEffectiveZone(surfaces, false, m_map[ndx.x][ndx.y].getZone()) == zone) {
+			pendingStarts.push_back(ndx);
+		}
+	}
+
+	PathfindGoalField *field = nullptr;
+	for (i=0; i<PATHFIND_GOAL_FIELDS; i++) {
+		if (m_goalFields[i].isCurrent(surfaces, mapChangeCount) && m_goalFields[i].isGoal(goalNdx, zone)) {
+			field = &m_goalFields[i];
+			break;
+		}
+	}
+	if (field) {
+		std::vector<ICoord2D> unreachedStarts;
+		for (size_t k=0; k<pendingStarts.size(); k++) {
+			if (field->getCost(pendingStarts[k].x, pendingStarts[k].y) > field->getSearchedCost()) {
+				unreachedStarts.push_back(pendingStarts[k]);
+			}
+		}
+		if (unreachedStarts.empty()) {
+			return;
+		}
+		if (field == m_buildingGoalField) {
+			// Still being built, so just have it go on until it reaches these starts too.
+			m_goalFieldPendingStarts.insert(m_goalFieldPendingStarts.end(), unreachedStarts.begin(), unreachedStarts.end());
+			m_goalFieldStopCost = PathfindGoalField::UNREACHED;
+			return;
+		}
+	}	else {
+		// Replace a stale field if there is one, else the oldest.
+		for (i=0; i<PATHFIND_GOAL_FIELDS; i++) {
+			if (m_goalFields[i].m_costs == nullptr || m_goalFields[i].m_mapChangeCount != mapChangeCount) {
+				field = &m_goalFields[i];
+				break;
+			}
+		}
+		if (field == nullptr) {
+			field = &m_goalFields[m_nextGoalField];
+			m_nextGoalField = (m_nextGoalField+1) % PATHFIND_GOAL_FIELDS;
+		}
+	}
+
+	const Int width = m_extent.hi.x - m_extent.lo.x + 1;
+	const Int height = m_extent.hi.y - m_extent.lo.y + 1;
+	if (field->m_costs == nullptr || field->m_extent.lo.x != m_extent.lo.x || field->m_extent.lo.y != m_extent.lo.y ||
+		field->m_extent.hi.x != m_extent.hi.x || field->m_extent.hi.y != m_extent.hi.y) {
+		field->reset();
+		field->m_costs = MSGNEW("PathfindGoalField") UnsignedInt[width*height];
+		field->m_extent = m_extent;
+		field->m_height = height;
+	}
+	memset(field->m_costs, 0xff, width*height*sizeof(UnsignedInt));
+	field->m_goalCell = goalNdx;
+	field->m_zone = zone;
+	field->m_surfaces = surfaces;
+	field->m_mapChangeCount = mapChangeCount;
+	field->m_searchedCost = 0;
+
+	// This stops any other build in progress. That field stays usable up to the cost it got to.
+	const Int numBuckets = sizeof(m_goalFieldBuckets)/sizeof(m_goalFieldBuckets[0]);
+	for (i=0; i<numBuckets; i++) {
+		m_goalFieldBuckets[i].clear();
+	}
+	const Int goalIndex = (goalNdx.x-m_extent.lo.x)*height + (goalNdx.y-m_extent.lo.y);
+	field->m_costs[goalIndex] = 0;
+	m_goalFieldBuckets[0].push_back(goalIndex);
+
+	m_buildingGoalField = field;
+	m_goalFieldPendingStarts.swap(pendingStarts);
+	m_goalFieldBuildCost = 0;
+	m_goalFieldBuildQueued = 1;
+	m_goalFieldNextStartCheck = 0;
+	m_goalFieldStopCost = PathfindGoalField::UNREACHED;
+	m_queueStatFieldsBuilt++;
+
+	// Reach the cells around the goal right away, the rest of the field follows over the next frames.
+	continueGoalField(PATHFIND_GOAL_FIELD_CELLS_PER_FRAME);
+}
+
+/**
+ * Runs the goal field Dijkstra search on from where the last slice stopped, one whole cost bucket at a
+ * time, until cellBudget cells were reached.  Between slices the field is final up to getSearchedCost().
+ */
+void Pathfinder::continueGoalField(Int cellBudget)
+{
+	PathfindGoalField *field = m_buildingGoalField;
+	if (field == nullptr) {
+		return;
+	}
+	if (field->m_mapChangeCount != m_zoneManager.getMapChangeCount()) {
+		m_buildingGoalField = nullptr; // the cells changed under it, so the field is stale anyway.
+		return;
+	}
+
+	static const ICoord2D delta[] =
+	{
+		{ 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 },
+		{ 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 }
+	};
+	const Int numNeighbors = 8;
+	const Int firstDiagonal = 4;
+	const Int adjacent[5] = {0, 1, 2, 3, 0};
+	const Int numBuckets = sizeof(m_goalFieldBuckets)/sizeof(m_goalFieldBuckets[0]); // must exceed COST_DIAGONAL.
+	const UnsignedInt startCheckInterval = 10*COST_ORTHOGONAL;
+	const UnsignedInt margin = 20*COST_ORTHOGONAL; // cells just behind the farthest start still get exact costs.
+
+	const IRegion2D &extent = field->m_extent;
+	const Int height = field->m_height;
+	const LocomotorSurfaceTypeMask surfaces = field->m_surfaces;
+	UnsignedInt *costs = field->m_costs;
+	UnsignedInt cost = m_goalFieldBuildCost;
+	Int cellsReached = 0;
+	for (;;) {
+		std::vector<Int> &bucket = m_goalFieldBuckets[cost % numBuckets];
+		for (size_t k=0; k<bucket.size(); k++) {
+			const Int index = bucket[k];
+			if (costs[index] != cost) {
+				continue; // a cheaper way here was found after this was queued.
+			}
+			cellsReached++;
+			const Int x = index/height + extent.lo.x;
+			const Int y = index%height + extent.lo.y;
+			Bool neighborFlags[8] = { 0 };
+			for (Int n=0; n<numNeighbors; n++) {
+				const Int newX = x + delta[n].x;
+				const Int newY = y + delta[n].y;
+				if (n>=firstDiagonal) {
+					// make sure one of the adjacent sides is open, like examineNeighboringCells.
+					if (!neighborFlags[adjacent[n-4]] && !neighborFlags[adjacent[n-3]]) {
+						continue;
+					}
+				}
+				if (!isGoalFieldCellPassable(surfaces, newX, newY)) {
+					continue;
+				}
+				neighborFlags[n] = true;
+				const UnsignedInt newCost = cost + (n<firstDiagonal ? COST_ORTHOGONAL : COST_DIAGONAL);
+				const Int newIndex = (newX-extent.lo.x)*height + (newY-extent.lo.y);
+				if (newCost < costs[newIndex]) {
+					costs[newIndex] = newCost;
+					m_goalFieldBuckets[newCost % numBuckets].push_back(newIndex);
+					m_goalFieldBuildQueued++;
+				}
+			}
+		}
+		m_goalFieldBuildQueued -= (Int)bucket.size();
+		bucket.clear();
+		field->m_searchedCost = cost;
+
+		if (cost >= m_goalFieldNextStartCheck && m_goalFieldStopCost == PathfindGoalField::UNREACHED) {
+			m_goalFieldNextStartCheck = cost + startCheckInterval;
+			size_t k = 0;
+			while (k < m_goalFieldPendingStarts.size()) {
+				const ICoord2D &start = m_goalFieldPendingStarts[k];
+				if (costs[(start.x-extent.lo.x)*height + (start.y-extent.lo.y)] <= cost) {
+					m_goalFieldPendingStarts[k] = m_goalFieldPendingStarts.back();
+					m_goalFieldPendingStarts.pop_back();
+				} else {
+					k++;
+				}
+			}
+			if (m_goalFieldPendingStarts.empty()) {
+				m_goalFieldStopCost = cost + margin;
+			}
+		}
+		if (m_goalFieldBuildQueued == 0 || cost >= m_goalFieldStopCost) {
+			m_buildingGoalField = nullptr;
+			break;
+		}
+		cost++;
+		if (cellsReached >= cellBudget) {
+			break;
+		}
+	}
+	m_goalFieldBuildCost = cost;
+
+	m_queueStatFieldCells += cellsReached;
+}
+
+/**
+ * Frees all goal fields, and stops the one under construction.
+ */
+void Pathfinder::resetGoalFields(void)
+{
+	for (Int i=0; i<PATHFIND_GOAL_FIELDS; i++) {
+		m_goalFields[i].reset();
+	}
+	m_nextGoalField = 0;
+	m_buildingGoalField = nullptr;
+	m_goalFieldPendingStarts.clear();
+	m_goalFieldBuildCost = 0;
+	m_goalFieldBuildQueued = 0;
+	m_goalFieldNextStartCheck = 0;
+	m_goalFieldStopCost = PathfindGoalField::UNREACHED;
+	const Int numBuckets = sizeof(m_goalFieldBuckets)/sizeof(m_goalFieldBuckets[0]);
+	for (Int j=0; j<numBuckets; j++) {
+		m_goalFieldBuckets[j].clear();
+	}
+}
+
+/**
+ * Returns the current goal field for surfaces that reached goalCell with the lowest cost, and that cost.
+ */
+const PathfindGoalField *Pathfinder::findGoalField(LocomotorSurfaceTypeMask surfaces, const ICoord2D &goalCell,
+																									 UnsignedInt &goalCost) const
+{
+	const PathfindGoalField *best = nullptr;
+	const UnsignedInt mapChangeCount = m_zoneManager.getMapChangeCount();
+	goalCost = PathfindGoalField::UNREACHED;
+	for (Int i=0; i<PATHFIND_GOAL_FIELDS; i++) {
+		const PathfindGoalField &field = m_goalFields[i];
+		if (!field.isCurrent(surfaces, mapChangeCount)) {
+			continue;
+		}
+		const UnsignedInt cost = field.getCost(goalCell.x, goalCell.y);
+		if (cost <= field.getSearchedCost() && cost < goalCost) {
+			best = &field;
+			goalCost = cost;
+		}
+	}
+	return best;
+}
+
+/**
+ * Estimated cost from cell to goalCell.  While a goal field steers the search, the difference of the
+ * field costs at cell and goalCell is a bound on that cost too (triangle inequality), and a far better
+ * one around obstacles than the straight line distance.
+ */
+UnsignedInt Pathfinder::costToGoal(PathfindCell *cell, PathfindCell *goalCell) const
+{
+	UnsignedInt cost = cell->costToGoal(goalCell);
+	if (m_activeGoalField) {
+		UnsignedInt cellCost = m_activeGoalField->getCost(cell->getXIndex(), cell->getYIndex());
+		if (cellCost == PathfindGoalField::UNREACHED) {
+			return cost;
+		}
+		if (cellCost > m_activeGoalField->getSearchedCost()) {
+			cellCost = m_activeGoalField->getSearchedCost() + 1; // only known to be beyond the searched area.
+		}
+		const UnsignedInt fieldCost = cellCost > m_activeGoalFieldGoalCost ?
+			cellCost - m_activeGoalFieldGoalCost : m_activeGoalFieldGoalCost - cellCost;
+		if (fieldCost > cost) {
+			cost = fieldCost;
+		}
+	}
+	return cost;
+}
+
+/**
+ * TheSuperHackers @performance Walks the search start down the active goal field, like a flow field,
+ * until it is close to the goal or the way down is blocked.  The walked cells become closed cells of the
+ * search, so buildActualPath picks them up, and A* only has to search the last stretch to the goal.
+ */
+PathfindCell *Pathfinder::descendGoalField(PathfindCell *startCell, PathfindCell *goalCell, const Object *obj,
+																					 const LocomotorSet& locomotorSet, Bool isHuman, Bool centerInCell, Int radius)
+{
+	if (startCell->getLayer() != LAYER_GROUND) {
+		return startCell;
+	}
+	static const ICoord2D delta[] =
+	{
+		{ 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 },
+		{ 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 }
+	};
+	const Int numNeighbors = 8;
+	const Int firstDiagonal = 4;
+	const Int adjacent[5] = {0, 1, 2, 3, 0};
+	const UnsignedInt stopCost = m_activeGoalFieldGoalCost + 10*COST_ORTHOGONAL;
+	const Bool isCrusher = obj ? obj->getCrusherLevel() > 0 : false;
+
+	PathfindCell *cell = startCell;
+	UnsignedInt cost = m_activeGoalField->getCost(cell->getXIndex(), cell->getYIndex());
+	while (cost != PathfindGoalField::UNREACHED && cost > stopCost) {
+		Bool neighborFlags[8] = { 0 };
+		PathfindCell *bestCell = nullptr;
+		UnsignedInt bestCost = cost;
+		ICoord2D bestCellCoord;
+		for (Int i=0; i<numNeighbors; i++) {
+			ICoord2D newCellCoord;
+			newCellCoord.x = cell->getXIndex() + delta[i].x;
+			newCellCoord.y = cell->getYIndex() + delta[i].y;
+			if (i>=firstDiagonal) {
+				// make sure one of the adjacent sides is open.
+				if (!neighborFlags[adjacent[i-4]] && !neighborFlags[adjacent[i-3]]) {
+					continue;
+				}
+			}
+			PathfindCell *newCell = getCell(LAYER_GROUND, newCellCoord.x, newCellCoord.y);
+			if (!validMovementPosition(isCrusher, locomotorSet.getValidSurfaces(), newCell, cell)) {
+				continue;
+			}
+			neighborFlags[i] = true;
+
+			const UnsignedInt newCost = m_activeGoalField->getCost(newCellCoord.x, newCellCoord.y);
+			if (newCost >= bestCost) {
+				continue;
+			}
+			// Leave anything the search would charge extra for to the search.
+			if (newCell == goalCell || newCell->getPinched() || newCell->getType() != PathfindCell::CELL_CLEAR) {
+				continue;
+			}
+			if (!m_zoneManager.isPassable(newCellCoord.x, newCellCoord.y)) {
+				continue;
+			}
+			if (isHuman && checkCellOutsideExtents(newCellCoord)) {
+				continue;
+			}
+			if (newCell->hasInfo() && (newCell->getOpen() || newCell->getClosed())) {
+				continue;
+			}
+			TCheckMovementInfo info;
+			info.cell = newCellCoord;
+			info.layer = LAYER_GROUND;
+			info.centerInCell = centerInCell;
+			info.radius = radius;
+			info.considerTransient = false;
+			info.acceptableSurfaces = locomotorSet.getValidSurfaces();
+			if (!checkForMovement(obj, info) || info.enemyFixed || info.allyFixedCount > 0) {
+				continue;
+			}
+			bestCell = newCell;
+			bestCost = newCost;
+			bestCellCoord = newCellCoord;
+		}
+		if (bestCell == nullptr || !bestCell->allocateInfo(bestCellCoord)) {
+			break;
+		}
+		bestCell->setBlockedByAlly(false);
+		bestCell->setParentCell(cell);
+		bestCell->setCostSoFar(bestCell->costSoFar(cell));
+		m_closedList = cell->putOnClosedList(m_closedList);
+		cell = bestCell;
+		cost = bestCost;
+	}
+	if (cell != startCell) {
+		cell->setTotalCost(cell->getCostSoFar() + costToGoal(cell, goalCell));
+	}
+	return cell;
+}
+
 void Pathfinder::checkChangeLayers(PathfindCell *parentCell)
 {
 	if (parentCell->getConnectLayer() == LAYER_INVALID)
@@ -5770,7 +6726,7 @@ struct ExamineCellsStruct
 			}
 			to->setBlockedByAlly(false);
 			Int costRemaining = 0;
-			costRemaining = to->costToGoal( d->goalCell );
+			costRemaining = d->thePathfinder->costToGoal( to, d->goalCell );
 
 			// check if this neighbor cell is already on the open (waiting to be tried)
 			// or closed (already tried) lists
@@ -5980,7 +6936,7 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 			Int costRemaining = 0;
 			if (goalCell) {
 				if (attackDistance == NO_ATTACK)  {
-					costRemaining = newCell->costToGoal( goalCell );
+					costRemaining = costToGoal( newCell, goalCell );
 				}	else {
 					dx = newCellCoord.x - goalCell->getXIndex();
 					dy = newCellCoord.y - goalCell->getYIndex();
@@ -6205,6 +7161,20 @@ Path *Pathfinder::internalFindPath( Object *obj, const LocomotorSet& locomotorSe
 		m_isTunneling = true;
 	}
 
+#if !RETAIL_COMPATIBLE_CRC
+	// TheSuperHackers @performance Let a group move's goal field steer the search if it reached this goal.
+	// The field treats every obstacle as impassable, so it may overestimate for a crusher, a unit leaving a
+	// structure, or a unit tunneling out of an impassable spot. Those must search without it, else the
+	// estimate isn't a lower bound any more.
+	if (layer != LAYER_WALL && destinationLayer != LAYER_WALL && !(obj && obj->isKindOf(KINDOF_DOZER)) &&
+		!isCrusher && !m_isTunneling && m_ignoreObstacleID == INVALID_ID) {
+		m_activeGoalField = findGoalField(locomotorSet.getValidSurfaces(), cell, m_activeGoalFieldGoalCost);
+		if (m_activeGoalField) {
+			m_queueStatFieldPaths++;
+		}
+	}
+#endif
+
 	parentCell->startPathfind(goalCell);
 
 	// initialize "open" list to contain start cell
@@ -6213,6 +7183,12 @@ Path *Pathfinder::internalFindPath( Object *obj, const LocomotorSet& locomotorSe
 	// "closed" list is initially empty
 	m_closedList = nullptr;
 
+#if !RETAIL_COMPATIBLE_CRC
+	if (m_activeGoalField && !m_isTunneling) {
+		m_openList = descendGoalField(parentCell, goalCell, obj, locomotorSet, isHuman, centerInCell, radius);
+	}
+#endif
+
 	Int cellCount = 0;
 
 	//
@@ -6248,6 +7224,7 @@ Path *Pathfinder::internalFindPath( Object *obj, const LocomotorSet& locomotorSe
 				debugShowSearch(true);
 
 			m_isTunneling = false;
+			m_activeGoalField = nullptr;
 			// construct and return path
 			Path *path =  buildActualPath( obj, locomotorSet.getValidSurfaces(), from, goalCell, centerInCell, false );
 #if RETAIL_COMPATIBLE_PATHFINDING
@@ -6274,6 +7251,7 @@ Path *Pathfinder::internalFindPath( Object *obj, const LocomotorSet& locomotorSe
 		cellCount += examineNeighboringCells(parentCell, goalCell, locomotorSet, isHuman, centerInCell, radius, startCellNdx, obj, NO_ATTACK);
 
 	}
+	m_activeGoalField = nullptr;
 
 	// failure - goal cannot be reached
 #if defined(RTS_DEBUG)
@@ -11030,6 +12008,13 @@ void Pathfinder::xfer( Xfer *xfer )
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
+	// TheSuperHackers @info The goal fields are not saved, so a loaded game starts without any. They are not
+	// dropped on save, as that would make a game that was saved play on differently from its replay.
+	if (xfer->getXferMode() == XFER_LOAD)
+	{
+		resetGoalFields();
+	}
+
 }
 
 //-----------------------------------------------------------------------------
@@ -32,12 +32,46 @@
 #include "Common/Xfer.h"
 #include "Common/INI.h"
 #include "Common/GameType.h"
+#include "Common/NameKeyGenerator.h"
 #include "GameLogic/Module/BodyModule.h"
 #include "GameLogic/Module/ActiveBody.h"
 #include "GameLogic/Components/ElectronicsComponent.h"
 #include "GameClient/Anim2D.h"
 #include "GameLogic/Object.h"
 
+// Name keys of every registered component name, indexed by ComponentNameIndex.
+static std::vector<NameKeyType> s_componentNameKeys;
+
+//-------------------------------------------------------------------------------------------------
+ComponentNameIndex Component::findNameIndex(const AsciiString& name)
+{
+	if (name.isEmpty())
+		return INVALID_COMPONENT_NAME_INDEX;
+
+	// Only runs while loading INI, and there are few distinct component names, so a scan is fine.
+	NameKeyType key = NAMEKEY(name);
+	for (size_t i = 0; i < s_componentNameKeys.size(); ++i)
+	{
+		if (s_componentNameKeys[i] == key)
+			return (ComponentNameIndex)i;
+	}
+	s_componentNameKeys.push_back(key);
+	return (ComponentNameIndex)(s_componentNameKeys.size() - 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+Int Component::getNameIndexCount()
+{
+	return (Int)s_componentNameKeys.size();
+}
+
+//-------------------------------------------------------------------------------------------------
+void Component::setName(const AsciiString& n)
+{
+	m_name = n;
+	m_nameIndex = findNameIndex(n);
+}
+
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature author 15/01/2025 Parse Component max health from INI
 //-------------------------------------------------------------------------------------------------
@@ -203,7 +237,7 @@ void Component::parseComponent(INI* ini, void* instance, void* /*store*/, const
 	ini->initFromINIMulti(component, p);
 	
 	// Add the parsed component to the module data
-	moduleData->m_componentsData.push_back(component);
+	moduleData->addComponentData(component);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -364,6 +398,7 @@ void Component::copyBaseComponentMembers(Component* dest) const
 		return;
 	
 	dest->m_name = m_name;
+	dest->m_nameIndex = m_nameIndex;
 	dest->m_displayName = m_displayName;
 	dest->m_icon = m_icon;
 	dest->m_displayDescription = m_displayDescription;
@@ -577,12 +612,12 @@ BodyDamageType Component::calcDamageState(Real componentHealth, Real componentMa
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature Ahmed Salah 15/01/2025 Aggregate Jamming helpers
 //-------------------------------------------------------------------------------------------------
-Real Component::getTotalComponentJammingDamageCap(const std::vector<Component>& components)
+Real Component::getTotalComponentJammingDamageCap(const std::vector<Component*>& components)
 {
     Real totalCap = 0.0f;
-    for (std::vector<Component>::const_iterator it = components.begin(); it != components.end(); ++it)
+    for (std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it)
     {
-        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(&(*it));
+        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(*it);
         if (ec)
         {
             Real cap = ec->getJammingDamageCap();
@@ -595,7 +630,7 @@ Real Component::getTotalComponentJammingDamageCap(const std::vector<Component>&
     return totalCap;
 }
 
-Real Component::getEffectiveJammingDamageCap(Real globalCap, const std::vector<Component>& components)
+Real Component::getEffectiveJammingDamageCap(Real globalCap, const std::vector<Component*>& components)
 {
     const Real componentCap = getTotalComponentJammingDamageCap(components);
     if (globalCap > 0.0f && componentCap > 0.0f)
@@ -613,12 +648,12 @@ Real Component::getEffectiveJammingDamageCap(Real globalCap, const std::vector<C
     return 0.0f;
 }
 
-UnsignedInt Component::getFastestComponentJammingHealRate(const std::vector<Component>& components, UnsignedInt globalRate)
+UnsignedInt Component::getFastestComponentJammingHealRate(const std::vector<Component*>& components, UnsignedInt globalRate)
 {
     UnsignedInt fastestRate = 0;
-    for (std::vector<Component>::const_iterator it = components.begin(); it != components.end(); ++it)
+    for (std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it)
     {
-        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(&(*it));
+        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(*it);
         if (ec)
         {
             UnsignedInt rate = ec->getJammingDamageHealRate();
@@ -634,12 +669,12 @@ UnsignedInt Component::getFastestComponentJammingHealRate(const std::vector<Comp
     return fastestRate == 0 ? globalRate : fastestRate;
 }
 
-Real Component::getTotalComponentJammingHealAmount(const std::vector<Component>& components, Real globalAmount)
+Real Component::getTotalComponentJammingHealAmount(const std::vector<Component*>& components, Real globalAmount)
 {
     Real totalAmount = 0.0f;
-    for (std::vector<Component>::const_iterator it = components.begin(); it != components.end(); ++it)
+    for (std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it)
     {
-        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(&(*it));
+        const ElectronicsComponent* ec = dynamic_cast<const ElectronicsComponent*>(*it);
         if (ec)
         {
             Real amt = ec->getJammingDamageHealAmount();
@@ -683,6 +718,8 @@ void Component::xfer( Xfer *xfer )
 
 	// Store minimal runtime state; config is owned by INI
 	xfer->xferAsciiString(&m_name);
+	if (xfer->getXferMode() == XFER_LOAD)
+		m_nameIndex = findNameIndex(m_name);
 	xfer->xferReal(&m_currentHealth);
 	xfer->xferReal(&m_currentMaxHealth);
 	xfer->xferBool(&m_userDisabled);
@@ -35,7 +35,7 @@ void ElectronicsComponent::parseElectronicsComponent(INI* ini, void* instance, v
 	ini->initFromINIMulti(component, p);
 	
 	// Add the parsed component to the module data
-	moduleData->m_componentsData.push_back(component);
+	moduleData->addComponentData(component);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -37,7 +37,7 @@ void InventoryStorageComponent::parseInventoryStorageComponent(INI* ini, void* i
 	ini->initFromINIMulti(component, p);
 	
 	// Add the parsed component to the module data
-	moduleData->m_componentsData.push_back(component);
+	moduleData->addComponentData(component);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -28,7 +28,7 @@ void JetEngineComponent::parseJetEngineComponent(INI* ini, void* instance, void*
 	MultiIniFieldParse p;
 	JetEngineComponent::buildFieldParse(p);
 	ini->initFromINIMulti(component, p);
-	moduleData->m_componentsData.push_back(component);
+	moduleData->addComponentData(component);
 }
 
 void JetEngineComponent::buildFieldParse(MultiIniFieldParse& p)
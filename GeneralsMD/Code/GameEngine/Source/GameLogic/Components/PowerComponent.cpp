@@ -42,7 +42,7 @@ void PowerComponent::parsePowerComponent(INI* ini, void* instance, void* /*store
 	ini->initFromINIMulti(component, p);
 	
 	// Add the parsed component to the module data
-	moduleData->m_componentsData.push_back(component);
+	moduleData->addComponentData(component);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -28,7 +28,7 @@ void RemoteControlComponent::parseRemoteControlComponent(INI* ini, void* instanc
     MultiIniFieldParse p;
     RemoteControlComponent::buildFieldParse(p);
     ini->initFromINIMulti(component, p);
-    moduleData->m_componentsData.push_back(component);
+    moduleData->addComponentData(component);
 }
 
 void RemoteControlComponent::buildFieldParse(MultiIniFieldParse& p)
@@ -134,7 +134,7 @@ void SensorComponent::parseSensorComponent(INI* ini, void* instance, void* /*sto
 	ini->initFromINIMulti(sensor, p);
 	
 	// Add the parsed component to the module data
-	moduleData->m_componentsData.push_back(sensor);
+	moduleData->addComponentData(sensor);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -137,15 +137,18 @@ UpdateSleepTime AutoSupplyItemBehavior::update()
 	PartitionFilter *filters[] = { &relationship, &filterAlive, &filterMapStatus, NULL };
 
 	// Scan objects in our region
-	ObjectIterator *iter = ThePartitionManager->iterateObjectsInRange(object->getPosition(), data->m_supplyRadius, FROM_CENTER_2D, filters);
-	MemoryPoolObjectHolder hold(iter);
+	// TheSuperHackers @performance Scan into a stack span instead of a pooled iterator
+	ObjectSpan targets;
+	ThePartitionManager->collectObjectsInRange(object->getPosition(), data->m_supplyRadius, FROM_CENTER_2D, targets, filters);
 	
 	if (data->m_supplyAllUnits)
 	{
 		// Supply all units in range
 		Bool anySupplied = false;
-		for (Object* target = iter->first(); target; target = iter->next())
+		for (Int i = 0; i < targets.getCount(); ++i)
 		{
+			Object* target = targets.getObject(i);
+
 			// Skip self
 			if (target == object)
 				continue;
@@ -170,8 +173,10 @@ UpdateSleepTime AutoSupplyItemBehavior::update()
 	{
 		// Supply only the best match (unit with lowest amount of the item)
 		Real lowestAmount = -1.0f;
-		for (Object* target = iter->first(); target; target = iter->next())
+		for (Int i = 0; i < targets.getCount(); ++i)
 		{
+			Object* target = targets.getObject(i);
+
 			// Skip self
 			if (target == object)
 				continue;
@@ -305,7 +305,7 @@ void AutoHealBehavior::pulseHealObject( Object *obj )
 		if (body && data->m_componentHealingAmount != 0.0f)
 		{
 			// Get components using the new Object method
-			std::vector<Component> components = obj->getComponents();
+			const std::vector<Component*>& components = body->getComponents();
 			
 			// Calculate component healing amount
 			Real componentHealingAmount = data->m_componentHealingAmount;
@@ -325,13 +325,12 @@ void AutoHealBehavior::pulseHealObject( Object *obj )
 			}
 			
 			// Heal components based on their healing types
-			for (std::vector<Component>::const_iterator it = components.begin();
+			for (std::vector<Component*>::const_iterator it = components.begin();
 				 it != components.end(); ++it)
 			{
-				const AsciiString componentName = it->getName();
-				Component* component = body->GetComponent<Component>(componentName);
+				Component* component = *it;
 				
-				if (component && component->getCurrentMaxHealth() > 0.0f) // Component exists
+				if (component->getCurrentMaxHealth() > 0.0f) // Component exists
 				{
 					Real maxHealth = component->getCurrentMaxHealth();
 					Real currentHealth = component->getCurrentHealth();
@@ -342,7 +341,7 @@ void AutoHealBehavior::pulseHealObject( Object *obj )
 						Real finalHealingAmount = healingNeeded * componentHealingAmount;
 						
 						// Apply healing based on component healing type
-						switch (it->getHealingType())
+						switch (component->getHealingType())
 						{
 							case COMPONENT_HEALING_NORMAL:
 								// Can be healed from destroyed to max normally
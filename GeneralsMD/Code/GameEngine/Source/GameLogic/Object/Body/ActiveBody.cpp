@@ -168,6 +168,40 @@ ActiveBodyModuleData::~ActiveBodyModuleData()
 		delete *it;
 	}
 	m_componentsData.clear();
+	m_componentSlots.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+void ActiveBodyModuleData::addComponentData(Component* component)
+{
+	m_componentsData.push_back(component);
+	m_componentSlots.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+Int ActiveBodyModuleData::getComponentSlot(ComponentNameIndex nameIndex) const
+{
+	if (nameIndex < 0)
+		return -1;
+
+	// Names keep getting registered while INI loads, so (re)build the table when it can't answer.
+	// addComponentData clears the table, which lands here too.
+	if (nameIndex >= (Int)m_componentSlots.size())
+	{
+		m_componentSlots.assign(Component::getNameIndexCount(), -1);
+		for (size_t i = 0; i < m_componentsData.size(); ++i)
+		{
+			ComponentNameIndex index = m_componentsData[i]->getNameIndex();
+			// First component with a name wins, same as the name search did.
+			if (index >= 0 && m_componentSlots[index] < 0)
+				m_componentSlots[index] = (Short)i;
+		}
+
+		if (nameIndex >= (Int)m_componentSlots.size())
+			return -1;
+	}
+
+	return m_componentSlots[nameIndex];
 }
 
 
@@ -1522,6 +1556,8 @@ void ActiveBody::updateBodyParticleSystems( void )
 //-------------------------------------------------------------------------------------------------
 void ActiveBody::internalChangeHealth( Real delta )
 {
+	getObject()->markCRCDirty();
+
 	// save the current health as the previous health
 	m_prevHealth = m_currentHealth;
 
@@ -2052,19 +2088,18 @@ void ActiveBody::initializeComponentHealth()
 	}
 
 //-------------------------------------------------------------------------------------------------
-// TheSuperHackers @feature author 15/01/2025 Get component definitions
-//-------------------------------------------------------------------------------------------------
-std::vector<Component> ActiveBody::getComponents() const
+Component* ActiveBody::getComponentByNameIndex(ComponentNameIndex nameIndex) const
 {
-	std::vector<Component> components;
+	Int slot = getActiveBodyModuleData()->getComponentSlot(nameIndex);
+	if (slot < 0 || slot >= (Int)m_components.size())
+		return NULL;
 
-	// Build a copy of components by value from instance component pointers
-	for (std::vector<Component*>::const_iterator it = m_components.begin(); it != m_components.end(); ++it)
-	{
-		if (*it)
-			components.push_back(**it);
-	}
-	return components;
+	Component* component = m_components[slot];
+	// A save made with different INI can rename an instance component; fall back to the search then.
+	if (component->getNameIndex() != nameIndex)
+		return BodyModule::getComponentByNameIndex(nameIndex);
+
+	return component;
 }
 
 //-------------------------------------------------------------------------------------------------
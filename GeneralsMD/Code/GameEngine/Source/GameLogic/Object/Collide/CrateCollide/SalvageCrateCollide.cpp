@@ -346,14 +346,14 @@ Bool SalvageCrateCollide::eligibleForFullRestore( Object *other )
 		return FALSE;
 
 	// Check if any components are damaged and can be restored
-	std::vector<Component> components = body->getComponents();
-	for( std::vector<Component>::const_iterator it = components.begin(); it != components.end(); ++it )
+	const std::vector<Component*>& components = body->getComponents();
+	for( std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it )
 	{
-		const Component& component = *it;
-		if( !component.getName().isEmpty() )
+		const Component* component = *it;
+		if( !component->getName().isEmpty() )
 		{
 			// If component is damaged (health < max), it can be restored
-			if( component.getCurrentHealth() < component.getCurrentMaxHealth() )
+			if( component->getCurrentHealth() < component->getCurrentMaxHealth() )
 				return TRUE;
 		}
 	}
@@ -670,17 +670,13 @@ void SalvageCrateCollide::doFullRestore( Object *other )
 		return;
 
 	// Restore all components to full health
-	std::vector<Component> components = body->getComponents();
-	for( std::vector<Component>::const_iterator it = components.begin(); it != components.end(); ++it )
+	const std::vector<Component*>& components = body->getComponents();
+	for( std::vector<Component*>::const_iterator it = components.begin(); it != components.end(); ++it )
 	{
-		const Component& component = *it;
-		if( !component.getName().isEmpty() )
+		Component* comp = *it;
+		if( !comp->getName().isEmpty() )
 		{
-			Component* comp = body->GetComponent<Component>(component.getName());
-			if (comp)
-			{
-				comp->setCurrentHealth(comp->getCurrentMaxHealth());
-			}
+			comp->setCurrentHealth(comp->getCurrentMaxHealth());
 		}
 	}
 
@@ -357,6 +357,7 @@ void TransportContain::onContaining( Object *rider, Bool wasSelected )
 		{
 			//Transfer the reload time from the rider to the bike
 			bikeWeapon->transferNextShotStatsFrom( *riderWeapon );
+			getObject()->markCRCDirty();
 		}
 	}
 
@@ -470,6 +471,7 @@ void TransportContain::onRemoving( Object *rider )
 		{
 			//Transfer the reload time from the bike to the rider
 			riderWeapon->transferNextShotStatsFrom( *bikeWeapon );
+			rider->markCRCDirty();
 		}
 	}
 
@@ -370,6 +370,7 @@ LocomotorTemplate::LocomotorTemplate()
 
 	// TheSuperHackers @feature Ahmed Salah 30/10/2025 Default engine component name
 	m_engineComponentName = EngineComponent::DEFAULT_MAIN_ENGINE_COMPONENT_NAME;
+	m_engineComponentNameIndex = Component::findNameIndex(m_engineComponentName);
 
 	m_rudderCorrectionDegree    = 0.0f;
 	m_rudderCorrectionRate      = 0.0f;
@@ -572,6 +573,7 @@ static void parseAffectedByComponents(INI* ini, void* instance, void* /*store*/,
 	
 	// Clear existing components
 	self->m_affectedByComponents.clear();
+	self->m_affectedByComponentIndices.clear();
 	
 	// Parse multiple component names from a single line
 	// Format: AffectedByComponents = TARGETING_SYSTEMS RELOADING_SYSTEM
@@ -581,11 +583,27 @@ static void parseAffectedByComponents(INI* ini, void* instance, void* /*store*/,
 		AsciiString componentName;
 		componentName.set(token);
 		self->m_affectedByComponents.push_back(componentName);
+		self->m_affectedByComponentIndices.push_back(Component::findNameIndex(componentName));
 		
 		token = ini->getNextTokenOrNull();
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+// TheSuperHackers @performance Resolve EngineComponentName to its name index once at load
+//-------------------------------------------------------------------------------------------------
+static void parseEngineComponentName(INI* ini, void* instance, void* /*store*/, const void* /*userData*/)
+{
+	LocomotorTemplate* self = (LocomotorTemplate*)instance;
+	INI::parseAsciiString(ini, instance, &self->m_engineComponentName, NULL);
+
+	// An empty name means the default engine, same as the name lookups always did.
+	if (self->m_engineComponentName.isEmpty())
+		self->m_engineComponentNameIndex = Component::findNameIndex(EngineComponent::DEFAULT_MAIN_ENGINE_COMPONENT_NAME);
+	else
+		self->m_engineComponentNameIndex = Component::findNameIndex(self->m_engineComponentName);
+}
+
 //-------------------------------------------------------------------------------------------------
 static void parseFrictionPerSec( INI* ini, void * /*instance*/, void *store, const void* /*userData*/ )
 {
@@ -673,7 +691,7 @@ const FieldParse* LocomotorTemplate::getFieldParse() const
 		{ "ElevatorCorrectionDegree",	 INI::parseReal, NULL, offsetof(LocomotorTemplate, m_elevatorCorrectionDegree) },
 		{ "ElevatorCorrectionRate",		 INI::parseReal, NULL, offsetof(LocomotorTemplate, m_elevatorCorrectionRate) },
 		{ "AffectedByComponents",		 parseAffectedByComponents, NULL, 0 },
-		{ "EngineComponentName",        INI::parseAsciiString, NULL, offsetof(LocomotorTemplate, m_engineComponentName) },
+		{ "EngineComponentName",        parseEngineComponentName, NULL, 0 },
 		{ "SpeedOutOfInventoryItem",    INI::parseVelocityReal, NULL, offsetof(LocomotorTemplate, m_maxSpeedOutOfInventoryItem) },
 		{ "TurnRateOutOfInventoryItem", INI::parseAngularVelocityReal, NULL, offsetof(LocomotorTemplate, m_maxTurnRateOutOfInventoryItem) },
 		{ "AccelerationOutOfInventoryItem", INI::parseAccelerationReal, NULL, offsetof(LocomotorTemplate, m_accelerationOutOfInventoryItem) },
@@ -975,10 +993,9 @@ EngineComponent* Locomotor::getEngineComponent(const Object* obj) const
 	if (!body)
 		return NULL;
 
-	const AsciiString& name = m_template->m_engineComponentName;
-	if (!name.isEmpty())
-		return body->GetComponent<EngineComponent>(name);
-	return body->GetComponent<EngineComponent>(EngineComponent::DEFAULT_MAIN_ENGINE_COMPONENT_NAME);
+	// TheSuperHackers @performance Look up by name index rather than comparing every component name
+	Component* component = body->getComponentByNameIndex(m_template->m_engineComponentNameIndex);
+	return component ? component->asEngineComponent() : NULL;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1042,18 +1059,9 @@ Bool LocomotorTemplate::canTakeoff(const Object* obj) const
 	BodyModuleInterface* body = obj->getBodyModule();
 	if (body)
 	{
-		const AsciiString& engineComponentName = m_engineComponentName;
-		EngineComponent* engineComponent = NULL;
-		
-		if (!engineComponentName.isEmpty())
-		{
-			engineComponent = body->GetComponent<EngineComponent>(engineComponentName);
-		}
-		else
-		{
-			// Use default engine component name if not specified
-			engineComponent = body->GetComponent<EngineComponent>(EngineComponent::DEFAULT_MAIN_ENGINE_COMPONENT_NAME);
-		}
+		// Empty EngineComponentName already resolved to the default engine name at parse time
+		Component* component = body->getComponentByNameIndex(m_engineComponentNameIndex);
+		EngineComponent* engineComponent = component ? component->asEngineComponent() : NULL;
 		
 		if (engineComponent && (engineComponent->isDestroyed() || engineComponent->isUserDisabled()))
 			return FALSE;
@@ -3195,11 +3203,10 @@ ComponentStatus LocomotorTemplate::getRequiredComponentsStatus(const Object* sou
 	Int lowestStatus = COMPONENT_STATUS_FULLY_FUNCTIONAL;
 	
 	// Check each required component and find the lowest status
-	for (std::vector<AsciiString>::const_iterator it = m_affectedByComponents.begin();
-		 it != m_affectedByComponents.end(); ++it)
+	for (std::vector<ComponentNameIndex>::const_iterator it = m_affectedByComponentIndices.begin();
+		 it != m_affectedByComponentIndices.end(); ++it)
 	{
-		const AsciiString& componentName = *it;
-		Component* component = body->GetComponent<Component>(componentName);
+		Component* component = body->getComponentByNameIndex(*it);
 		
 		// If component doesn't exist, skip it (not required)
 		if (!component)
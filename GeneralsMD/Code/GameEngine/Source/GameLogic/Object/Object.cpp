@@ -261,6 +261,7 @@ Object::Object(const ThingTemplate* tt, const ObjectStatusMaskType& objectStatus
 	m_privateStatus(0),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE),
+	m_crcStepsValid(FALSE),
 	m_singleUseCommandUsed(FALSE),
 	m_scriptStatus(0),
 	m_enteredOrExitedFrame(0),
@@ -929,6 +930,7 @@ void Object::setGeometryInfoZ(Real newZ)
 //=============================================================================
 void Object::friend_setUndetectedDefector(Bool status)
 {
+	markCRCDirty();
 	if (status)
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
@@ -995,6 +997,7 @@ void Object::setOrRestoreTeam(Team* team, Bool restoring)
 		{
 			m_team->removeFrom_TeamMemberList(this);
 			m_team->getControllingPlayer()->becomingTeamMember(this, false);
+			TheScriptEngine->notifyOfTeamChange(m_team);
 		}
 	}
 
@@ -1008,6 +1011,7 @@ void Object::setOrRestoreTeam(Team* team, Bool restoring)
 		{
 			m_team->prependTo_TeamMemberList(this);
 			m_team->getControllingPlayer()->becomingTeamMember(this, true);
+			TheScriptEngine->notifyOfTeamChange(m_team);
 		}
 
 		// now, adjust the attitude of the unit to its new team.
@@ -1360,6 +1364,7 @@ Bool Object::testArmorSetFlag(ArmorSetType ast) const
 //=============================================================================
 void Object::reloadAllAmmo(Bool now)
 {
+	markCRCDirty();
 	m_weaponSet.reloadAllAmmo(this, now);
 }
 
@@ -1964,6 +1969,7 @@ void Object::reactToTurretChange(WhichTurretType turret, Real oldRotation, Real
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
 	//USE_PERF_TIMER(Object_reactToTransformChange)
+	markCRCDirty();
 	if (_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
 		TheGameLogic->destroyObject(this);
@@ -2179,6 +2185,10 @@ void Object::healCompletely()
 //-------------------------------------------------------------------------------------------------
 void Object::setEffectivelyDead(Bool dead)
 {
+	markCRCDirty();
+	if (dead != isEffectivelyDead())
+		TheScriptEngine->notifyOfTeamChange(m_team);
+
 	if (dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
@@ -2194,6 +2204,7 @@ void Object::setEffectivelyDead(Bool dead)
 //-------------------------------------------------------------------------------------------------
 void Object::setCaptured(Bool isCaptured)
 {
+	markCRCDirty();
 	if (isCaptured)
 		BitSet(m_privateStatus, CAPTURED);
 	else
@@ -2834,6 +2845,7 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 			if (m_team)
 				m_team->setEnteredExited();
 			TheGameLogic->updateObjectsChangedTriggerAreas();
+			TheScriptEngine->notifyOfTriggerAreaChange(m_triggerInfo[i].pTrigger);
 #ifdef RTS_DEBUG
 			//TheScriptEngine->AppendDebugMessage("Object exited.", false);
 #endif
@@ -2868,6 +2880,7 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 				if (m_team)
 					m_team->setEnteredExited();
 				TheGameLogic->updateObjectsChangedTriggerAreas();
+				TheScriptEngine->notifyOfTriggerAreaChange(pTrig);
 				++m_numTriggerAreasActive;
 #ifdef RTS_DEBUG
 				//TheScriptEngine->AppendDebugMessage("Object entered.", false);
@@ -3028,6 +3041,7 @@ void Object::friend_prepareForMapBoundaryAdjust(void)
 //-------------------------------------------------------------------------------------------------
 void Object::friend_notifyOfNewMapBoundary(void)
 {
+	markCRCDirty();
 	ThePartitionManager->registerObject(this);
 	TheRadar->addObject(this);
 	TheAI->pathfinder()->addObjectToPathfindMap(this);
@@ -3337,6 +3351,7 @@ Bool Object::isMassSelectable() const
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -3348,6 +3363,7 @@ void Object::setWeaponSetFlag(WeaponSetType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponSetFlag(WeaponSetType wst)
 {
+	markCRCDirty();
 	m_curWeaponSetFlags.set(wst, 0);
 	m_weaponSet.updateWeaponSet(this);
 	if (m_drawable)
@@ -4317,6 +4333,61 @@ void Object::crc(Xfer* xfer)
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Incremental version of crc() for the logic CRC. The CRC steps of the last full crc() are replayed
+	* as long as the object has not been marked dirty. Because every CRC step depends on the previous
+	* one, the cached steps cannot be folded into a single value, but replaying them skips the
+	* traversal of the object, its experience tracker and its weapons.
+	* With 'validate', the cache is compared against a full recalculation. */
+//-------------------------------------------------------------------------------------------------
+void Object::crcIncremental( XferCRC *xfer, Bool validate )
+{
+#ifdef DEBUG_CRC
+	// the object CRC logging happens inside crc(), so do not bypass it
+	if (g_logObjectCRCs)
+	{
+		m_crcStepsValid = FALSE;
+		xfer->xferSnapshot(this);
+		return;
+	}
+#endif // DEBUG_CRC
+
+	if (!m_crcStepsValid)
+	{
+		m_crcSteps.clear();
+		xfer->setStepRecording(&m_crcSteps);
+		xfer->xferSnapshot(this);
+		xfer->setStepRecording(nullptr);
+		m_crcStepsValid = TRUE;
+		return;
+	}
+
+	if (validate)
+	{
+		std::vector<UnsignedInt> steps;
+		steps.reserve(m_crcSteps.size());
+
+		XferCRC validateXfer;
+		validateXfer.open("validateIncrementalCRC");
+		validateXfer.setStepRecording(&steps);
+		validateXfer.xferSnapshot(this);
+		validateXfer.setStepRecording(nullptr);
+		validateXfer.close();
+
+		if (steps != m_crcSteps)
+		{
+			DEBUG_CRASH(("Incremental CRC of object %d (%s) on frame %d is stale, its state changed without markCRCDirty()",
+				m_id, getTemplate()->getName().str(), TheGameLogic->getFrame()));
+			m_crcSteps.swap(steps);
+		}
+	}
+
+	if (!m_crcSteps.empty())
+	{
+		xfer->addCRCSteps(&m_crcSteps[0], (Int)m_crcSteps.size());
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Object xfer implemtation
 	* Version Info:
@@ -4812,6 +4883,7 @@ Bool Object::affectedByUpgrade(const UpgradeTemplate* upgradeT) const
 //-------------------------------------------------------------------------------------------------
 void Object::giveUpgrade(const UpgradeTemplate* upgradeT)
 {
+	markCRCDirty();
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set(upgradeT->getUpgradeMask());
@@ -4829,6 +4901,7 @@ void Object::giveUpgrade(const UpgradeTemplate* upgradeT)
 //-------------------------------------------------------------------------------------------------
 void Object::removeUpgrade(const UpgradeTemplate* upgradeT)
 {
+	markCRCDirty();
 	m_objectUpgradesCompleted.clear(upgradeT->getUpgradeMask());
 	for (BehaviorModule** module = m_behaviors; *module; ++module)
 	{
@@ -4988,6 +5061,7 @@ void Object::onDie(DamageInfo* damageInfo)
 //-------------------------------------------------------------------------------------------------
 void Object::setWeaponBonusCondition(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition |= (1 << wst);
 
@@ -5001,6 +5075,7 @@ void Object::setWeaponBonusCondition(WeaponBonusConditionType wst)
 //-------------------------------------------------------------------------------------------------
 void Object::clearWeaponBonusCondition(WeaponBonusConditionType wst)
 {
+	markCRCDirty();
 	WeaponBonusConditionFlags oldCondition = m_weaponBonusCondition;
 	m_weaponBonusCondition &= ~(1 << wst);
 
@@ -6454,6 +6529,7 @@ void Object::doCommandButtonUsingWaypoints(const CommandButton* commandButton, c
 // ------------------------------------------------------------------------------------------------
 void Object::clearLeechRangeModeForAllWeapons()
 {
+	markCRCDirty();
 	m_weaponSet.clearLeechRangeModeForAllWeapons();
 }
 
@@ -7159,19 +7235,26 @@ UnicodeString Object::getExtendedDescription(Bool skipBodyModules) const
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature author 15/01/2025 Get component information from ActiveBody
 //-------------------------------------------------------------------------------------------------
-std::vector<Component> Object::getComponents() const
+const std::vector<Component*>& Object::getComponents() const
 {
-	std::vector<Component> components;
-	
+	static const std::vector<Component*> noComponents;
+
 	// Get the BodyModule
 	BodyModuleInterface* body = getBodyModule();
 	if (!body)
-		return components;
-	
+		return noComponents;
+
 	// Use the public BodyModule::getComponents() method
 	return body->getComponents();
 }
 
+//-------------------------------------------------------------------------------------------------
+Bool Object::hasComponents() const
+{
+	BodyModuleInterface* body = getBodyModule();
+	return body && body->hasComponents();
+}
+
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature Ahmed Salah - Get all info icons (weapons and armor)
 //-------------------------------------------------------------------------------------------------
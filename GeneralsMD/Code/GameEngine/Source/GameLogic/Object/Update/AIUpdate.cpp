@@ -885,6 +885,8 @@ Bool AIUpdateInterface::chooseLocomotorSetExplicit(LocomotorSetType wst)
 				m_locomotorSet.addLocomotor(lt);
 		}
 		m_curLocomotorSet = wst;
+		// the team trigger area conditions only consider members with matching surfaces
+		TheScriptEngine->notifyOfTeamChange(getObject()->getTeam());
 		return TRUE;
 	}
 	return FALSE;
@@ -2686,6 +2688,8 @@ Bool AIUpdateInterface::isAllowedToRespondToAiCommands(const AICommandParms* par
 //-------------------------------------------------------------------------------------------------
 void AIUpdateInterface::aiDoCommand(const AICommandParms* parms)
 {
+	getObject()->markCRCDirty();
+
 	// TheSuperHackers @info The AiCommandParms for m_obj, m_otherObj and m_team should be null tested before use.
 	// These variables could relate to a deleted object when a pending command is reconstituted.
 
@@ -2943,10 +2943,10 @@ Bool JetAIUpdate::shouldForceReturn() const
 	BodyModuleInterface* body = obj->getBodyModule();
 	if (body)
 	{
-		std::vector<Component> components = obj->getComponents();
-		for (const Component& component : components)
+		const std::vector<Component*>& components = body->getComponents();
+		for (const Component* component : components)
 		{
-			if (component.getForceReturnOnDestroy() && component.isDestroyed())
+			if (component->getForceReturnOnDestroy() && component->isDestroyed())
 			{
 				return TRUE;
 			}
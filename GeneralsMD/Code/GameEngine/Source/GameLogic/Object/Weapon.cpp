@@ -219,6 +219,7 @@ static void parseAffectedByComponents(INI* ini, void* instance, void* /*store*/,
 	
 	// Clear existing components
 	self->m_affectedByComponents.clear();
+	self->m_affectedByComponentIndices.clear();
 	
 	// Parse multiple component names from a single line
 	// Format: AffectedByComponents = TARGETING_SYSTEMS RELOADING_SYSTEM
@@ -228,11 +229,22 @@ static void parseAffectedByComponents(INI* ini, void* instance, void* /*store*/,
 		AsciiString componentName;
 		componentName.set(token);
 		self->m_affectedByComponents.push_back(componentName);
+		self->m_affectedByComponentIndices.push_back(Component::findNameIndex(componentName));
 		
 		token = ini->getNextTokenOrNull();
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+// TheSuperHackers @performance Resolve ComponentName to its name index once at load
+//-------------------------------------------------------------------------------------------------
+static void parseComponentName(INI* ini, void* instance, void* /*store*/, const void* /*userData*/)
+{
+	WeaponTemplate* self = (WeaponTemplate*)instance;
+	INI::parseAsciiString(ini, instance, &self->m_componentName, NULL);
+	self->m_componentNameIndex = Component::findNameIndex(self->m_componentName);
+}
+
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature author 15/01/2025 Parse SecondaryComponentDamage from INI
 //-------------------------------------------------------------------------------------------------
@@ -375,7 +387,7 @@ const FieldParse WeaponTemplate::TheWeaponTemplateFieldParseTable[] =
 	{ "PrimaryComponentDamage",		parsePrimaryComponentDamage,								NULL,							0 },
 	{ "SecondaryComponentDamage",	parseSecondaryComponentDamage,							NULL,							0 },
 	{ "AffectedByComponents",		parseAffectedByComponents,								NULL,							0 },
-	{ "ComponentName",				INI::parseAsciiString,									NULL,							offsetof(WeaponTemplate, m_componentName) },
+	{ "ComponentName",				parseComponentName,										NULL,							0 },
 	{ NULL,												NULL,																		NULL,							0 }
 
 };
@@ -391,6 +403,7 @@ WeaponTemplate::WeaponTemplate() : m_nextTemplate(nullptr)
 	m_name = "NoNameWeapon";
 	m_displayName = UnicodeString();
 	m_nameKey = NAMEKEY_INVALID;
+	m_componentNameIndex = INVALID_COMPONENT_NAME_INDEX;
 	m_primaryDamage = 0.0f;
 	m_primaryDamageRadius = 0.0f;
 	m_secondaryDamage = 0.0f;
@@ -1474,23 +1487,29 @@ static Bool is2DDistSquaredLessThan(const Coord3D& a, const Coord3D& b, Real dis
 
 //-------------------------------------------------------------------------------------------------
 // TheSuperHackers @feature author 02/10/2025 Prepare list of applicable affected victims
-std::vector<Object*> WeaponTemplate::getApplicableAffectedVictims(
-	SimpleObjectIterator* iter,
-	Object* curVictim,
+// TheSuperHackers @performance The victims are tagged with their priority group and stable sorted
+// afterwards, which gives the same order as inserting them into the middle of a vector.
+void WeaponTemplate::getApplicableAffectedVictims(
+	const ObjectSpan& candidates,
 	const Object* source,
 	const Object* primaryVictim,
-	Int affects
+	Int affects,
+	ObjectSpan& applicableVictims
 ) const
 {
-	std::vector<Object*> applicableVictims;
-	// TheSuperHackers @feature author 02/10/2025 Track counts for priority sorting
-	Int selfKillCount = 0;
-	Int enemyCount = 0;
-	Int neutralCount = 0;
-	Real curVictimDistSqr;
-	
-	for (; curVictim != NULL; curVictim = iter ? iter->nextWithNumeric(&curVictimDistSqr) : NULL)
+	enum
 	{
+		PRIORITY_SELF_KILL,
+		PRIORITY_ENEMY,
+		PRIORITY_NEUTRAL,
+		PRIORITY_OTHER
+	};
+
+	applicableVictims.makeEmpty();
+
+	for (Int candidateIndex = 0; candidateIndex < candidates.getCount(); ++candidateIndex)
+	{
+		Object* curVictim = candidates.getObject(candidateIndex);
 		Bool killSelf = false;
 		Bool shouldInclude = true;
 		
@@ -1585,47 +1604,34 @@ std::vector<Object*> WeaponTemplate::getApplicableAffectedVictims(
 		if (shouldInclude || killSelf)
 		{
 			// TheSuperHackers @feature author 02/10/2025 Insert victims at correct position based on relationship priority
+			Real priority = PRIORITY_OTHER;
 			if (killSelf)
 			{
-				// Self-kill targets have highest priority - insert at beginning
-				applicableVictims.insert(applicableVictims.begin() + selfKillCount, curVictim);
-				selfKillCount++;
+				// Self-kill targets have highest priority
+				priority = PRIORITY_SELF_KILL;
 			}
 			else if (source != NULL)
 			{
 				Relationship r = curVictim->getRelationship(source);
 				if (r == ENEMIES)
 				{
-					// Insert enemies after self-kill targets
-					applicableVictims.insert(applicableVictims.begin() + selfKillCount + enemyCount, curVictim);
-					enemyCount++;
+					// Enemies after self-kill targets
+					priority = PRIORITY_ENEMY;
 				}
 				else if (r == NEUTRAL)
 				{
-					// Insert neutrals after enemies
-					applicableVictims.insert(applicableVictims.begin() + selfKillCount + enemyCount + neutralCount, curVictim);
-					neutralCount++;
-				}
-				else if (r == ALLIES)
-				{
-					// Insert allies after neutrals - add to end
-					applicableVictims.push_back(curVictim);
-				}
-				else
-				{
-					// Unknown relationship, add to end
-					applicableVictims.push_back(curVictim);
+					// Neutrals after enemies
+					priority = PRIORITY_NEUTRAL;
 				}
+				// Allies and unknown relationships go to the end
 			}
-			else
-			{
-				// No source, can't determine relationship - add to end
-				applicableVictims.push_back(curVictim);
-			}
+			// No source, can't determine relationship - add to end
+
+			applicableVictims.insert(curVictim, priority);
 		}
 	}
-	
-	return applicableVictims;
+
+	applicableVictims.sort(ITER_SORTED_NEAR_TO_FAR);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1697,7 +1703,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 	ObjectStatusTypes damageStatusType = getDamageStatusType();
 	if (getProjectileTemplate() == nullptr || isProjectileDetonation)
 	{
-		SimpleObjectIterator* iter;
+		// TheSuperHackers @performance Collect the victims into stack spans instead of a pooled iterator.
+		ObjectSpan candidates;
 		Object* curVictim;
 		Real curVictimDistSqr;
 
@@ -1713,16 +1720,14 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		Real radius = max(primaryRadius, secondaryRadius);
 		if (radius > 0.0f)
 		{
-			iter = ThePartitionManager->iterateObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE);
-			curVictim = iter->firstWithNumeric(&curVictimDistSqr);
+			ThePartitionManager->collectObjectsInRange(pos, radius, DAMAGE_RANGE_CALC_TYPE, candidates);
 		}
 		else
 		{			
 			// check against victimID rather than primaryVictim, since we may have targeted a legitimate victim
 			// that got killed before the damage was dealt... (srj)
-			iter = NULL;
-			curVictim = primaryVictim;
-			curVictimDistSqr = 0.0f;
+			if (primaryVictim != NULL)
+				candidates.insert(primaryVictim, 0.0f);
 
 			if (affects & WEAPON_KILLS_SELF)
 			{
@@ -1737,17 +1742,17 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 				return;
 			}
 		}
-		MemoryPoolObjectHolder hold(iter);
 
 		// TheSuperHackers @feature author 02/10/2025 Get applicable affected victims
-		std::vector<Object*> applicableVictims = getApplicableAffectedVictims(iter, curVictim, source, primaryVictim, affects);
+		ObjectSpan applicableVictims;
+		getApplicableAffectedVictims(candidates, source, primaryVictim, affects, applicableVictims);
 		
 		// TheSuperHackers @feature author 02/10/2025 Apply simultaneous damage limit during execution
 		Int maxSimultaneous = getRadiusDamageAffectsMaxSimultaneous();
 		Int affectedCount = 0;
 		
 		// Process each applicable victim (up to maxSimultaneous limit)
-		for (size_t victimIndex = 0; victimIndex < applicableVictims.size(); victimIndex++)
+		for (Int victimIndex = 0; victimIndex < applicableVictims.getCount(); victimIndex++)
 		{
 			// Check simultaneous damage limit during execution
 			if (maxSimultaneous > 0 && affectedCount >= maxSimultaneous)
@@ -1756,7 +1761,7 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 				break;
 			}
 			
-			curVictim = applicableVictims[victimIndex];
+			curVictim = applicableVictims.getObject(victimIndex);
 			
 			// Calculate distance for this victim
 			if (primaryVictim && curVictim == primaryVictim)
@@ -2456,6 +2461,9 @@ void Weapon::rebuildScatterTargets()
 //-------------------------------------------------------------------------------------------------
 void Weapon::reloadWithBonus(const Object* sourceObj, const WeaponBonus& bonus, Bool loadInstantly)
 {
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	auto initialAmmoInClip = m_ammoInClip;
 	if (m_template->getClipSize() > 0
 			&& m_ammoInClip == m_template->getClipSize()
@@ -2562,6 +2570,9 @@ static void clipToTerrainExtent(Coord3D& approachTargetPos)
 //-------------------------------------------------------------------------------------------------
 void Weapon::onWeaponBonusChange(const Object* source)
 {
+	if (source)
+		source->markCRCDirty();
+
 	// We are concerned with our reload times being off if our ROF just changed.
 
 	WeaponBonus bonus;
@@ -3019,6 +3030,9 @@ Real Weapon::estimateWeaponDamage(const Object* sourceObj, const Object* victimO
 //-------------------------------------------------------------------------------------------------
 void Weapon::newProjectileFired(const Object* sourceObj, const Object* projectile, const Object* victimObj, const Coord3D* victimPos)
 {
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	// TheSuperHackers @feature author 15/01/2025 Consume inventory when projectile is fired
 	// const AsciiString& consumeInventory = m_template->getConsumeInventory();
 	// if (!consumeInventory.isEmpty())
@@ -3121,6 +3135,9 @@ Bool Weapon::privateFireWeapon(
 	if (projectileID)
 		*projectileID = INVALID_ID;
 
+	if (sourceObj)
+		sourceObj->markCRCDirty();
+
 	if (!m_template)
 		return false;
 
@@ -3334,6 +3351,9 @@ Bool Weapon::privateFireWeapon(
 //-------------------------------------------------------------------------------------------------
 void Weapon::preFireWeapon(const Object* source, const Object* victim)
 {
+	if (source)
+		source->markCRCDirty();
+
 	Int delay = getPreAttackDelay(source, victim);
 	if (delay > 0)
 	{
@@ -4257,7 +4277,7 @@ Bool Weapon::isWeaponSlotFunctional(const Object* source) const
 		return true; // No body module - assume functional
 	
 	// Check if object has no components - if so, weapon should work
-	if (body->getComponents().empty())
+	if (!body->hasComponents())
 		return true; // No components - assume functional
 
 
@@ -4265,15 +4285,12 @@ Bool Weapon::isWeaponSlotFunctional(const Object* source) const
 		return false;
 
 
-	// Get component name from weapon template
-	AsciiString componentName = m_template->getComponentName();
-	
 	// If no component name specified, weapon should work (no component restriction)
-	if (componentName.isEmpty())
+	if (m_template->m_componentNameIndex == INVALID_COMPONENT_NAME_INDEX)
 		return true;
 	
-	// Get the component using the new GetComponent method
-	Component* component = body->GetComponent<Component>(componentName);
+	// TheSuperHackers @performance Look up by name index rather than comparing every component name
+	Component* component = body->getComponentByNameIndex(m_template->m_componentNameIndex);
 	
 	// If component doesn't exist, weapon should work (no component restriction)
 	if (!component)
@@ -4315,11 +4332,10 @@ Bool WeaponTemplate::areRequiredComponentsFunctional(const Object* source) const
 		return true; // No body module - assume functional
 	
 	// Check each required component
-	for (std::vector<AsciiString>::const_iterator it = m_affectedByComponents.begin();
-		 it != m_affectedByComponents.end(); ++it)
+	for (std::vector<Int>::const_iterator it = m_affectedByComponentIndices.begin();
+		 it != m_affectedByComponentIndices.end(); ++it)
 	{
-		const AsciiString& componentName = *it;
-		Component* component = body->GetComponent<Component>(componentName);
+		Component* component = body->getComponentByNameIndex(*it);
 		
 		// If component doesn't exist, skip it (not required)
 		if (!component)
@@ -458,8 +458,22 @@ m_minFade(0.0f),
 m_numAttackInfo(0),
 m_shownMPLocalDefeatWindow(FALSE),
 m_objectsShouldReceiveDifficultyBonus(TRUE),
-m_ChooseVictimAlwaysUsesNormal(false)
+m_ChooseVictimAlwaysUsesNormal(false),
+m_bindingGeneration(1),
+m_namedObjectsGeneration(1),
+m_scriptScheduleBuilt(false),
+m_scriptScheduleMismatches(0)
 {
+	for (Int i=0; i<PERIMETER_SLOTS; i++) {
+		m_perimeterTriggers[0][i] = m_perimeterTriggers[1][i] = nullptr;
+		m_perimeterTriggerGenerations[0][i] = m_perimeterTriggerGenerations[1][i] = 0;
+	}
+	for (Int i=0; i<MAX_COUNTERS; i++) {
+		m_counterScripts[i] = nullptr;
+	}
+	for (Int i=0; i<MAX_FLAGS; i++) {
+		m_flagScripts[i] = nullptr;
+	}
 	st_CanAppCont = true;
 	st_LastCurrentFrame = st_CurrentFrame = 0;
 	// By default, difficulty should be normal.
@@ -553,6 +567,13 @@ void ScriptEngine::init( void )
 	m_numFrames=0;
 	m_totalUpdateTime=0;
 	m_maxUpdateTime=0;
+	m_profileConditionType = Condition::NUM_ITEMS;
+	for (Int i=0; i<=Condition::NUM_ITEMS; i++) {
+		m_boundParameterLookups[i] = 0;
+		m_namedParameterLookups[i] = 0;
+	}
+	m_scheduledScriptEvaluations = 0;
+	m_scheduledScriptSkips = 0;
 #endif
 #endif
 
@@ -5275,6 +5296,7 @@ void ScriptEngine::reset( void )
 	m_numAttackInfo = 1;
 	m_numFlags = 1;
 	m_endGameTimer = -1;
+	m_scriptScheduleMismatches = 0;
 	m_closeWindowTimer = -1;
 
 	m_callingTeam = nullptr;
@@ -5297,6 +5319,7 @@ void ScriptEngine::reset( void )
 		m_flags[i].value = false;
 		m_flags[i].name.clear();
 	}
+	clearScriptSchedule();
 
 	m_breezeInfo.m_direction = PI/3;
 	m_breezeInfo.m_directionVec.x = Sin(m_breezeInfo.m_direction);
@@ -5360,6 +5383,34 @@ void ScriptEngine::reset( void )
 		}
 		DEBUG_LOG(("***"));
 	}
+
+	// TheSuperHackers @performance Report how many team, unit and trigger name lookups the parameter bindings saved.
+	Int totalBound = 0;
+	Int totalNamed = 0;
+	for (i=0; i<=Condition::NUM_ITEMS; i++) {
+		if (m_boundParameterLookups[i] + m_namedParameterLookups[i] == 0) {
+			continue;
+		}
+		if (totalBound + totalNamed == 0) {
+			DEBUG_LOG(("***SCRIPT PARAMETER BINDINGS (bound lookups / name lookups):"));
+		}
+		DEBUG_LOG(("  %s %d / %d", i<Condition::NUM_ITEMS ? m_conditionTemplates[i].m_internalName.str() : "(actions)",
+			m_boundParameterLookups[i], m_namedParameterLookups[i]));
+		totalBound += m_boundParameterLookups[i];
+		totalNamed += m_namedParameterLookups[i];
+		m_boundParameterLookups[i] = 0;
+		m_namedParameterLookups[i] = 0;
+	}
+	if (totalBound + totalNamed > 0) {
+		DEBUG_LOG(("  Total %d / %d, %.1f%% of lookups skipped the name search.", totalBound, totalNamed,
+			100.0f*totalBound/(totalBound+totalNamed)));
+	}
+	if (m_scheduledScriptEvaluations + m_scheduledScriptSkips > 0) {
+		DEBUG_LOG(("***SCRIPT SCHEDULE: %d evaluations, %d skipped because nothing they read changed.",
+			m_scheduledScriptEvaluations, m_scheduledScriptSkips));
+	}
+	m_scheduledScriptEvaluations = 0;
+	m_scheduledScriptSkips = 0;
 #endif
 #endif
 
@@ -5393,6 +5444,8 @@ void ScriptEngine::reset( void )
 
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
+	++m_bindingGeneration;
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -5427,6 +5480,9 @@ void ScriptEngine::reset( void )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::newMap( void )
 {
+	// New teams and trigger areas, so every parameter binding needs resolving again.
+	++m_bindingGeneration;
+
 	m_numCounters = 1;
 	Int i;
 	for (i=0; i<MAX_COUNTERS; i++) {
@@ -5439,6 +5495,7 @@ void ScriptEngine::newMap( void )
 		m_flags[i].value = false;
 		m_flags[i].name.clear();
 	}
+	clearScriptSchedule();
 	m_endGameTimer = -1;
 	m_closeWindowTimer = -1;
 #ifdef SPECIAL_SCRIPT_PROFILING
@@ -5565,10 +5622,15 @@ void ScriptEngine::update( void )
 			// If counter has any time left, decrement.  Counters go to -1 and stop.
 			if (m_counters[i].value >= 0) {
 				m_counters[i].value--;
+				markCounterChanged(i);
 			}
 		}
 	}
 
+	if (!m_scriptScheduleBuilt) {
+		buildScriptSchedule();
+	}
+
 	// Evaluate the scripts.
 	for (i=0; i<TheSidesList->getNumSides(); i++) {
 		m_currentPlayer = ThePlayerList->getNthPlayer(i);
@@ -5593,6 +5655,9 @@ void ScriptEngine::update( void )
 	ThePlayerList->updateTeamStates();
 
 	// Clear the UI Interaction flags.
+	if (!m_uiInteractions.empty()) {
+		markUIInteractionsChanged();
+	}
 	m_uiInteractions.clear();
 
 	// update all sequential stuff.
@@ -5770,6 +5835,7 @@ void ScriptEngine::clearFlag(const AsciiString &name)
 		for (i=1; i<m_numFlags; i++) {
 			if ((modName==m_flags[i].name)) {
 				m_flags[i].value = FALSE;
+				markFlagChanged(i);
 			}
 		}
 	}
@@ -5943,6 +6009,101 @@ PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( AsciiString name )
 	return trig;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Given a trigger area parameter, return the associated trigger area, or null if one doesn't exist.
+The area is resolved once per binding generation; the skirmish perimeters depend on the current
+player, so they are bound to the perimeter and resolved through a per start position table. */
+//-------------------------------------------------------------------------------------------------
+PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( const Parameter *triggerParm )
+{
+	Parameter::BindingType binding = triggerParm->getBindingType(m_bindingGeneration);
+	if (binding != Parameter::BINDING_TRIGGER && binding != Parameter::BINDING_PERIMETER) {
+		const AsciiString& name = triggerParm->getString();
+		if (name == MY_INNER_PERIMETER) {
+			triggerParm->bindIndex(Parameter::BINDING_PERIMETER, m_bindingGeneration, PERIMETER_MY_INNER);
+		} else if (name == MY_OUTER_PERIMETER) {
+			triggerParm->bindIndex(Parameter::BINDING_PERIMETER, m_bindingGeneration, PERIMETER_MY_OUTER);
+		} else if (name == ENEMY_INNER_PERIMETER) {
+			triggerParm->bindIndex(Parameter::BINDING_PERIMETER, m_bindingGeneration, PERIMETER_ENEMY_INNER);
+		} else if (name == ENEMY_OUTER_PERIMETER) {
+			triggerParm->bindIndex(Parameter::BINDING_PERIMETER, m_bindingGeneration, PERIMETER_ENEMY_OUTER);
+		} else {
+			triggerParm->bindTrigger(m_bindingGeneration, TheTerrainLogic->getTriggerAreaByName(name));
+		}
+		binding = triggerParm->getBindingType(m_bindingGeneration);
+		countParameterLookup(FALSE);
+	} else {
+		countParameterLookup(TRUE);
+	}
+
+	if (binding == Parameter::BINDING_PERIMETER) {
+		return getPerimeterTriggerArea(triggerParm->getBoundIndex());
+	}
+
+	PolygonTrigger *trig = triggerParm->getBoundTrigger();
+	if (trig==nullptr) {
+		AsciiString msg = "!!!WARNING!!! Trigger area '";
+		msg.concat(triggerParm->getString());
+		msg.concat("' not found.");
+		AppendDebugMessage(msg, TRUE);
+	}
+
+	return trig;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the current player's or current enemy's inner or outer perimeter trigger area. */
+//-------------------------------------------------------------------------------------------------
+PolygonTrigger *ScriptEngine::getPerimeterTriggerArea( Int perimeter )
+{
+	Int mpNdx = -1;
+	if (perimeter == PERIMETER_MY_INNER || perimeter == PERIMETER_MY_OUTER) {
+		if (m_currentPlayer == nullptr) {
+			return nullptr;
+		}
+		mpNdx = m_currentPlayer->getMpStartIndex()+1;
+	} else if (m_currentPlayer) {
+		Player *enemy = getCurrentPlayer()->getCurrentEnemy();
+		if (enemy) {
+			mpNdx = enemy->getMpStartIndex()+1;
+		}
+	}
+
+	Int inner = (perimeter == PERIMETER_MY_INNER || perimeter == PERIMETER_ENEMY_INNER) ? 1 : 0;
+	AsciiString name;
+	Int slot = mpNdx+1;
+	if (slot < 0 || slot >= PERIMETER_SLOTS) {
+		name.format("%s%d", inner ? INNER_PERIMETER : OUTER_PERIMETER, mpNdx);
+		return getQualifiedTriggerAreaByName(name);
+	}
+
+	PolygonTrigger *trig = m_perimeterTriggers[inner][slot];
+	if (trig == nullptr || m_perimeterTriggerGenerations[inner][slot] != m_bindingGeneration) {
+		// Missing areas are looked up again so the warning is still posted on every evaluation.
+		name.format("%s%d", inner ? INNER_PERIMETER : OUTER_PERIMETER, mpNdx);
+		trig = getQualifiedTriggerAreaByName(name);
+		m_perimeterTriggers[inner][slot] = trig;
+		m_perimeterTriggerGenerations[inner][slot] = m_bindingGeneration;
+	}
+	return trig;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Counts a parameter lookup against the condition being evaluated, for the profile report. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::countParameterLookup( Bool bound )
+{
+#ifdef SPECIAL_SCRIPT_PROFILING
+#ifdef DEBUG_LOGGING
+	if (bound) {
+		m_boundParameterLookups[m_profileConditionType]++;
+	} else {
+		m_namedParameterLookups[m_profileConditionType]++;
+	}
+#endif
+#endif
+}
+
 
 
 //-------------------------------------------------------------------------------------------------
@@ -5967,6 +6128,50 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 		return m_conditionTeam;
 	}
 	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( teamName );
+	return getTeamFromPrototype(theTeamProto, teamName);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed - same as above, but resolves the parameter's team prototype once per binding
+generation instead of looking the name up on every evaluation. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const Parameter *teamParm)
+{
+	Parameter::BindingType binding = teamParm->getBindingType(m_bindingGeneration);
+	if (binding != Parameter::BINDING_TEAM && binding != Parameter::BINDING_BY_NAME) {
+		const AsciiString& teamName = teamParm->getString();
+		if (teamName == THIS_TEAM || teamName == TEAM_THE_PLAYER) {
+			teamParm->bindByName(m_bindingGeneration);
+		} else {
+			teamParm->bindTeam(m_bindingGeneration, TheTeamFactory->findTeamPrototype(teamName));
+		}
+		binding = teamParm->getBindingType(m_bindingGeneration);
+		countParameterLookup(FALSE);
+	} else {
+		countParameterLookup(binding == Parameter::BINDING_TEAM);
+	}
+
+	if (binding == Parameter::BINDING_BY_NAME) {
+		return getTeamNamed(teamParm->getString());
+	}
+
+	// A team's name is its prototype's name, so matching prototypes is the same test as matching names.
+	TeamPrototype *theTeamProto = teamParm->getBoundTeam();
+	if (theTeamProto == nullptr) return nullptr;
+	if (m_callingTeam && m_callingTeam->getPrototype() == theTeamProto) {
+		return m_callingTeam;
+	}
+	if (m_conditionTeam && m_conditionTeam->getPrototype() == theTeamProto) {
+		return m_conditionTeam;
+	}
+	return getTeamFromPrototype(theTeamProto, teamParm->getString());
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamFromPrototype - Returns the team instance scripts refer to by the prototype's name. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamFromPrototype( TeamPrototype *theTeamProto, const AsciiString& teamName )
+{
 	if (theTeamProto == nullptr) return nullptr;
 	if (theTeamProto->getIsSingleton()) {
 		Team *theTeam = theTeamProto->getFirstItemIn_TeamInstanceList();
@@ -6007,6 +6212,44 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 	return nullptr;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** getUnitNamed - same as above, but remembers which named objects entry the parameter refers to.
+The entry's object is read every time, so dead and transferred names are still honored. */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamed(const Parameter *unitParm)
+{
+	Parameter::BindingType binding = unitParm->getBindingType(m_namedObjectsGeneration);
+	if (binding != Parameter::BINDING_UNIT && binding != Parameter::BINDING_BY_NAME) {
+		const AsciiString& unitName = unitParm->getString();
+		if (unitName == THIS_OBJECT) {
+			unitParm->bindByName(m_namedObjectsGeneration);
+		} else {
+			Int index = -1;
+			for (Int i = 0; i < (Int)m_namedObjects.size(); ++i) {
+				if (unitName == m_namedObjects[i].first) {
+					index = i;
+					break;
+				}
+			}
+			unitParm->bindIndex(Parameter::BINDING_UNIT, m_namedObjectsGeneration, index);
+		}
+		binding = unitParm->getBindingType(m_namedObjectsGeneration);
+		countParameterLookup(FALSE);
+	} else {
+		countParameterLookup(binding == Parameter::BINDING_UNIT);
+	}
+
+	if (binding == Parameter::BINDING_BY_NAME) {
+		return getUnitNamed(unitParm->getString());
+	}
+
+	Int index = unitParm->getBoundIndex();
+	if (index < 0) {
+		return nullptr;
+	}
+	return m_namedObjects[index].second;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** didUnitExist */
 //-------------------------------------------------------------------------------------------------
@@ -6138,6 +6381,8 @@ Int ScriptEngine::allocateCounter( const AsciiString& name)
 		m_counters[m_numCounters].name = name;
 		i = m_numCounters;
 		m_numCounters++;
+		ScheduledScriptsByName::iterator it = m_counterScriptsByName.find(name);
+		m_counterScripts[i] = (it != m_counterScriptsByName.end()) ? &it->second : nullptr;
 		return(i);
 	}
 	return 0; // Shouldn't ever happen.
@@ -6276,6 +6521,8 @@ Int ScriptEngine::allocateFlag( const AsciiString& name)
 		m_flags[m_numFlags].name = name;
 		i = m_numFlags;
 		m_numFlags++;
+		ScheduledScriptsByName::iterator it = m_flagScriptsByName.find(name);
+		m_flagScripts[i] = (it != m_flagScriptsByName.end()) ? &it->second : nullptr;
 		return(i);
 	}
 	return 0; // Shouldn't ever happen.
@@ -6364,6 +6611,7 @@ void ScriptEngine::setCounter( ScriptAction *pAction )
 	}
 	Int value = pAction->getParameter(1)->getInt();
 	m_counters[counterNdx].value = value;
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6432,6 +6680,7 @@ void ScriptEngine::addCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value += value;
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6447,6 +6696,7 @@ void ScriptEngine::subCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value -= value;
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6491,6 +6741,7 @@ void ScriptEngine::setFlag( ScriptAction *pAction )
 	}
 	Bool value = pAction->getParameter(1)->getInt();
 	m_flags[flagNdx].value = value;
+	markFlagChanged(flagNdx);
 }
 
 
@@ -6753,6 +7004,7 @@ void ScriptEngine::setTimer( ScriptAction *pAction, Bool millisecondTimer, Bool
 		m_counters[counterNdx].value = value;
 	}
 	m_counters[counterNdx].isCountdownTimer = true;
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6767,6 +7019,7 @@ void ScriptEngine::pauseTimer( ScriptAction *pAction )
 		pAction->getParameter(0)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].isCountdownTimer = false;
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6782,6 +7035,7 @@ void ScriptEngine::restartTimer( ScriptAction *pAction )
 	}
 	if (m_counters[counterNdx].value > 0) {
 		m_counters[counterNdx].isCountdownTimer = true;
+		markCounterChanged(counterNdx);
 	}
 }
 
@@ -6807,6 +7061,7 @@ void ScriptEngine::adjustTimer( ScriptAction *pAction, Bool millisecondTimer, Bo
 			value = -value;
 		m_counters[counterNdx].value += value;
 	}
+	markCounterChanged(counterNdx);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7014,7 +7269,7 @@ void ScriptEngine::executeScript( Script *pScript )
 	} else {
 		m_conditionTeam = nullptr;
 		// If conditions evaluate to true, execute actions.
-		if (evaluateConditions(pScript)) {
+		if (evaluateScheduledConditions(pScript)) {
 			if (pScript->getAction()) {
 				// Script Debug window
 				_appendMessage(pScript->getName());
@@ -7052,6 +7307,11 @@ void ScriptEngine::executeScript( Script *pScript )
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 {
+#ifdef SPECIAL_SCRIPT_PROFILING
+#ifdef DEBUG_LOGGING
+	LatchRestore<Int> latch(m_profileConditionType, pCondition->getConditionType());
+#endif
+#endif
 	switch (pCondition->getConditionType()) {
 		default:
 			return TheScriptConditions->evaluateCondition(pCondition);
@@ -7063,6 +7323,269 @@ Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Evaluates a script's conditions, reusing the last result of a scheduled script if nothing it
+reads has changed since. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::evaluateScheduledConditions( Script *pScript )
+{
+	if (!pScript->isConditionsScheduled()) {
+		return evaluateConditions(pScript);
+	}
+	if (m_callingTeam || m_callingObject) {
+		// <This Team> and team names matching the calling team resolve differently here, so
+		// poll, and don't let the next regular evaluation reuse this result.
+		pScript->markConditionsChanged();
+		return evaluateConditions(pScript);
+	}
+	if (!pScript->haveConditionsChanged()) {
+		if (TheGlobalData->m_verifyScriptSchedule) {
+			verifyScheduledConditions(pScript, pScript->getScheduledConditionResult());
+		}
+#ifdef SPECIAL_SCRIPT_PROFILING
+#ifdef DEBUG_LOGGING
+		m_scheduledScriptSkips++;
+#endif
+#endif
+		return pScript->getScheduledConditionResult();
+	}
+#ifdef SPECIAL_SCRIPT_PROFILING
+#ifdef DEBUG_LOGGING
+	m_scheduledScriptEvaluations++;
+#endif
+#endif
+	// Store the result before the actions run, so actions changing what we read mark us changed.
+	Bool result = evaluateConditions(pScript);
+	pScript->setScheduledConditionResult(result);
+	return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @debug Polls a scheduled script's conditions the way an unscheduled script does,
+and reports a mismatch with the result the schedule kept. Enabled with -verifyScriptSchedule. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::verifyScheduledConditions( Script *pScript, Bool scheduledResult )
+{
+	const Bool polledResult = evaluateConditions(pScript);
+	if (polledResult == scheduledResult) {
+		return;
+	}
+	++m_scriptScheduleMismatches;
+	DEBUG_CRASH(("Scheduled script '%s' evaluated to %d on frame %d, but the schedule kept %d.",
+		pScript->getName().str(), polledResult, TheGameLogic->getFrame(), scheduledResult));
+	if (TheGlobalData->m_simulateReplays.size() > 0) {
+		// Note that we use printf here because replays are simulated from cmd.
+		printf("Script schedule mismatch: script '%s' frame %u\n", pScript->getName().str(), TheGameLogic->getFrame());
+		fflush(stdout);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Finds the scripts whose conditions can be scheduled, and registers them with the counters,
+flags, teams and trigger areas they read. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::buildScriptSchedule( void )
+{
+	clearScriptSchedule();
+	Int i;
+	for (i=0; i<TheSidesList->getNumSides(); i++) {
+		ScriptList *pSL = TheSidesList->getSideInfo(i)->getScriptList();
+		if (pSL == nullptr) continue;
+		Script *pScr;
+		for (pScr = pSL->getScript(); pScr; pScr=pScr->getNext()) {
+			scheduleScript(pScr);
+		}
+		ScriptGroup *pGroup;
+		for (pGroup = pSL->getScriptGroup(); pGroup; pGroup=pGroup->getNext()) {
+			for (pScr = pGroup->getScript(); pScr; pScr=pScr->getNext()) {
+				scheduleScript(pScr);
+			}
+		}
+	}
+
+	// Counters and flags allocated so far; the rest are looked up in allocateCounter & allocateFlag.
+	for (i=1; i<m_numCounters; i++) {
+		ScheduledScriptsByName::iterator it = m_counterScriptsByName.find(m_counters[i].name);
+		if (it != m_counterScriptsByName.end()) {
+			m_counterScripts[i] = &it->second;
+		}
+	}
+	for (i=1; i<m_numFlags; i++) {
+		ScheduledScriptsByName::iterator it = m_flagScriptsByName.find(m_flags[i].name);
+		if (it != m_flagScriptsByName.end()) {
+			m_flagScripts[i] = &it->second;
+		}
+	}
+	m_scriptScheduleBuilt = true;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Forgets the scheduled scripts. The schedule is rebuilt on the next update. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::clearScriptSchedule( void )
+{
+	Int i;
+	for (i=0; i<MAX_COUNTERS; i++) {
+		m_counterScripts[i] = nullptr;
+	}
+	for (i=0; i<MAX_FLAGS; i++) {
+		m_flagScripts[i] = nullptr;
+	}
+	m_counterScriptsByName.clear();
+	m_flagScriptsByName.clear();
+	m_teamScripts.clear();
+	m_triggerAreaScripts.clear();
+	m_scriptScheduleBuilt = false;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the team prototype a scheduled team condition reads, or null if the condition can't be
+scheduled because the team depends on who is calling or doesn't exist. */
+//-------------------------------------------------------------------------------------------------
+TeamPrototype *ScriptEngine::getScheduledTeam( const Parameter *teamParm )
+{
+	if (teamParm == nullptr) {
+		return nullptr;
+	}
+	const AsciiString& teamName = teamParm->getString();
+	if (teamName == THIS_TEAM || teamName == TEAM_THE_PLAYER) {
+		return nullptr;
+	}
+	return TheTeamFactory->findTeamPrototype(teamName);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns the trigger area a scheduled condition reads, or null if the condition can't be
+scheduled because the area depends on the current player or doesn't exist. */
+//-------------------------------------------------------------------------------------------------
+PolygonTrigger *ScriptEngine::getScheduledTriggerArea( const Parameter *triggerParm )
+{
+	if (triggerParm == nullptr) {
+		return nullptr;
+	}
+	const AsciiString& name = triggerParm->getString();
+	if (name == MY_INNER_PERIMETER || name == MY_OUTER_PERIMETER ||
+			name == ENEMY_INNER_PERIMETER || name == ENEMY_OUTER_PERIMETER) {
+		return nullptr;
+	}
+	return TheTerrainLogic->getTriggerAreaByName(name);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Schedules a script if all its conditions only read counters, flags, timers, team membership
+or whether a team is inside a trigger area. Any other condition keeps the script polled. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::scheduleScript( Script *pScript )
+{
+	Bool scheduled = pScript->getConditionTeamName().isEmpty();
+	OrCondition *pOr;
+	Condition *pCondition;
+	for (pOr = pScript->getOrCondition(); pOr && scheduled; pOr = pOr->getNextOrCondition()) {
+		for (pCondition = pOr->getFirstAndCondition(); pCondition && scheduled; pCondition = pCondition->getNext()) {
+			switch (pCondition->getConditionType()) {
+				case Condition::CONDITION_TRUE:
+				case Condition::CONDITION_FALSE:
+					break;
+				case Condition::COUNTER:
+				case Condition::TIMER_EXPIRED:
+				case Condition::FLAG:
+					scheduled = (pCondition->getParameter(0) != nullptr);
+					break;
+				case Condition::TEAM_DESTROYED:
+				case Condition::TEAM_HAS_UNITS:
+					scheduled = (getScheduledTeam(pCondition->getParameter(0)) != nullptr);
+					break;
+				case Condition::TEAM_INSIDE_AREA_PARTIALLY:
+				case Condition::TEAM_INSIDE_AREA_ENTIRELY:
+				case Condition::TEAM_OUTSIDE_AREA_ENTIRELY:
+					scheduled = (getScheduledTeam(pCondition->getParameter(0)) != nullptr &&
+						getScheduledTriggerArea(pCondition->getParameter(1)) != nullptr);
+					break;
+				default:
+					scheduled = false;
+					break;
+			}
+		}
+	}
+	pScript->setConditionsScheduled(scheduled);
+	if (!scheduled) {
+		return;
+	}
+
+	for (pOr = pScript->getOrCondition(); pOr; pOr = pOr->getNextOrCondition()) {
+		for (pCondition = pOr->getFirstAndCondition(); pCondition; pCondition = pCondition->getNext()) {
+			ScheduledScripts *scripts[2] = { nullptr, nullptr };
+			switch (pCondition->getConditionType()) {
+				case Condition::COUNTER:
+				case Condition::TIMER_EXPIRED:
+					scripts[0] = &m_counterScriptsByName[pCondition->getParameter(0)->getString()];
+					break;
+				case Condition::FLAG:
+					scripts[0] = &m_flagScriptsByName[pCondition->getParameter(0)->getString()];
+					break;
+				case Condition::TEAM_DESTROYED:
+				case Condition::TEAM_HAS_UNITS:
+					scripts[0] = &m_teamScripts[getScheduledTeam(pCondition->getParameter(0))];
+					break;
+				case Condition::TEAM_INSIDE_AREA_PARTIALLY:
+				case Condition::TEAM_INSIDE_AREA_ENTIRELY:
+				case Condition::TEAM_OUTSIDE_AREA_ENTIRELY:
+					scripts[0] = &m_teamScripts[getScheduledTeam(pCondition->getParameter(0))];
+					scripts[1] = &m_triggerAreaScripts[getScheduledTriggerArea(pCondition->getParameter(1))];
+					break;
+				default:
+					break;
+			}
+			for (Int i=0; i<2; i++) {
+				if (scripts[i] && (scripts[i]->empty() || scripts[i]->back() != pScript)) {
+					scripts[i]->push_back(pScript);
+				}
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Something the given scheduled scripts read changed, so they need evaluating again. */
+//-------------------------------------------------------------------------------------------------
+static void markScheduledScriptsChanged( const std::vector<Script*> &scripts )
+{
+	for (std::vector<Script*>::const_iterator it = scripts.begin(); it != scripts.end(); ++it) {
+		(*it)->markConditionsChanged();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** A counter or timer changed, so the scheduled scripts reading it need evaluating again. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::markCounterChanged( Int counterNdx )
+{
+	if (m_counterScripts[counterNdx]) {
+		markScheduledScriptsChanged(*m_counterScripts[counterNdx]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** A flag changed, so the scheduled scripts reading it need evaluating again. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::markFlagChanged( Int flagNdx )
+{
+	if (m_flagScripts[flagNdx]) {
+		markScheduledScriptsChanged(*m_flagScripts[flagNdx]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** A UI interaction raised or dropped a flag. evaluateFlag matches interactions by the condition's
+flag name, so rather than repeat that match every scheduled flag script is evaluated again. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::markUIInteractionsChanged( void )
+{
+	for (ScheduledScriptsByName::const_iterator it = m_flagScriptsByName.begin(); it != m_flagScriptsByName.end(); ++it) {
+		markScheduledScriptsChanged(it->second);
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Execute an action specified by pActionHead */
 //-------------------------------------------------------------------------------------------------
@@ -7115,6 +7638,7 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 
 		if (pNewObject == (it->second)) {
 			it->first = objName;
+			++m_namedObjectsGeneration;
 			return;
 		}
 	}
@@ -7124,6 +7648,7 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 	req.second = pNewObject;
 
 	m_namedObjects.push_back(req);
+	++m_namedObjectsGeneration;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7260,6 +7785,7 @@ void ScriptEngine::notifyOfAcquiredScience( Int playerIndex, ScienceType science
 void ScriptEngine::signalUIInteract(const AsciiString& hookName)
 {
 	m_uiInteractions.push_front(hookName);
+	markUIInteractionsChanged();
 #ifdef DEBUG_LOGGING
 	AppendDebugMessage(hookName, false); // don't bother in Release
 #endif
@@ -7711,6 +8237,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache( void )
 {
 	m_namedObjects.clear();
+	++m_namedObjectsGeneration;
 
 	if( !TheGameLogic )
 	{
@@ -7805,6 +8332,28 @@ void ScriptEngine::notifyOfObjectCreationOrDestruction(void)
 	m_frameObjectCountChanged = TheGameLogic->getFrame();
 }
 
+void ScriptEngine::notifyOfTeamChange(Team *team)
+{
+	if (team == nullptr || m_teamScripts.empty()) {
+		return;
+	}
+	ScheduledScriptsByTeam::const_iterator it = m_teamScripts.find(team->getPrototype());
+	if (it != m_teamScripts.end()) {
+		markScheduledScriptsChanged(it->second);
+	}
+}
+
+void ScriptEngine::notifyOfTriggerAreaChange(const PolygonTrigger *trigger)
+{
+	if (m_triggerAreaScripts.empty()) {
+		return;
+	}
+	ScheduledScriptsByTriggerArea::const_iterator it = m_triggerAreaScripts.find(trigger);
+	if (it != m_triggerAreaScripts.end()) {
+		markScheduledScriptsChanged(it->second);
+	}
+}
+
 void ScriptEngine::notifyOfTeamDestruction(Team *teamDestroyed)
 {
 	if (!teamDestroyed) {
@@ -8949,6 +9498,10 @@ void ScriptEngine::xfer( Xfer *xfer )
 	// num flags
 	xfer->xferInt( &m_numFlags );
 
+	// loaded counters and flags, so every scheduled script needs evaluating again
+	if( xfer->getXferMode() == XFER_LOAD )
+		clearScriptSchedule();
+
 	// attack priority info
 	UnsignedShort attackPriorityInfoSize = m_numAttackInfo;
 	xfer->xferUnsignedShort( &attackPriorityInfoSize );
@@ -9009,6 +9562,8 @@ void ScriptEngine::xfer( Xfer *xfer )
 		// according to John M., so we're clearing it now
 		//
 		m_namedObjects.clear();
+		++m_namedObjectsGeneration;
+		++m_bindingGeneration;
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -905,6 +905,9 @@ m_hard(true),
 m_delayEvaluationSeconds(0),
 m_conditionTime(0),
 m_conditionExecutedCount(0),
+m_conditionsScheduled(false),
+m_conditionsChanged(true),
+m_scheduledConditionResult(false),
 m_frameToEvaluateAt(0),
 m_isSubroutine(false),
 m_hasWarnings(false),
@@ -1790,6 +1793,7 @@ void Parameter::setCoord3D(const Coord3D *pLoc)
 void Parameter::qualify(const AsciiString& qualifier,
 			const AsciiString& playerTemplateName, const AsciiString& newPlayerName)
 {
+	clearBinding();
 	AsciiString tmpString;
 	switch (m_paramType) {
 		case SIDE:
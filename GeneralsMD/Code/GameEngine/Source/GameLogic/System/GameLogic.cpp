@@ -3718,6 +3718,7 @@ void GameLogic::update( void )
 				USE_PERF_TIMER(GameLogic_update_normal)
 
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
 
 				#ifdef DEBUG_LOGGING
 					UpdateSleepTime sleep = u->update();
@@ -3759,6 +3760,7 @@ void GameLogic::update( void )
 
 				//DEBUG_LOG(("calling update %08lx (%d %d)...",update,update->friend_getNextCallFrame(),update->friend_getNextCallPhase()));
 				m_curUpdateModule = u;
+				u->friend_getObject()->markCRCDirty();
 
 				sleepLen = u->update();
 				DEBUG_ASSERTCRASH(sleepLen > 0, ("you may not return 0 from update"));
@@ -3994,6 +3996,7 @@ void GameLogic::destroyObject( Object *obj )
 
 	// mark object as destroyed
 	obj->setStatus( MAKE_OBJECT_STATUS_MASK( OBJECT_STATUS_DESTROYED ) );
+	TheScriptEngine->notifyOfTeamChange(obj->getTeam());
 
 	// We desperately need to stop here, or else the destructor of the statemachine will try to do
 	// stopping logic, which uses virtual functions and deleted modules, which will crash us.
@@ -4079,9 +4082,22 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 
 	marker = "MARKER:Objects";
 	xferCRC->xferAsciiString(&marker);
-	for( obj = m_objList; obj; obj=obj->getNextObject() )
+	// TheSuperHackers @performance The incremental logic CRC replays the cached CRC steps of objects
+	// that were not marked dirty. It produces the same CRC, so it is only a shortcut for XferCRC.
+	if (TheGlobalData->m_incrementalLogicCRC && xferCRC->getXferMode() == XFER_CRC)
 	{
-		xferCRC->xferSnapshot( obj );
+		const Bool validate = TheGlobalData->m_validateIncrementalLogicCRC;
+		for( obj = m_objList; obj; obj=obj->getNextObject() )
+		{
+			obj->crcIncremental( xferCRC, validate );
+		}
+	}
+	else
+	{
+		for( obj = m_objList; obj; obj=obj->getNextObject() )
+		{
+			xferCRC->xferSnapshot( obj );
+		}
 	}
 	UnsignedInt seed = GetGameLogicRandomSeedCRC();
 	if (isInGameLogicUpdate())
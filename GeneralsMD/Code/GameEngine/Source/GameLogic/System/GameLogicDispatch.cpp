@@ -973,13 +973,13 @@ void GameLogic::logicMessageDispatcher( GameMessage *msg, void *userData )
 							BodyModuleInterface* body = firstObj->getBodyModule();
 							if (body)
 							{
-								std::vector<Component> components = firstObj->getComponents();
-								for (std::vector<Component>::const_iterator it = components.begin();
+								const std::vector<Component*>& components = body->getComponents();
+								for (std::vector<Component*>::const_iterator it = components.begin();
 									 it != components.end(); ++it)
 								{
-									if (it->getName().getLength() == componentLength)
+									if ((*it)->getName().getLength() == componentLength)
 									{
-										componentName = it->getName();
+										componentName = (*it)->getName();
 										break;
 									}
 								}
@@ -1013,17 +1013,17 @@ void GameLogic::logicMessageDispatcher( GameMessage *msg, void *userData )
 					if (componentName.isEmpty())
 					{
 						// Replace all damaged components
-						std::vector<Component> components = obj->getComponents();
-						for (std::vector<Component>::const_iterator compIt = components.begin();
+						const std::vector<Component*>& components = body->getComponents();
+						for (std::vector<Component*>::const_iterator compIt = components.begin();
 							 compIt != components.end(); ++compIt)
 						{
-							const Component& component = *compIt;
-							if (component.getReplacementCost() > 0)
+							const Component* component = *compIt;
+							if (component->getReplacementCost() > 0)
 							{
 								// Only include cost if component is damaged
-								if (component.getCurrentHealth() < component.getCurrentMaxHealth())
+								if (component->getCurrentHealth() < component->getCurrentMaxHealth())
 								{
-									totalCost += component.getReplacementCost();
+									totalCost += component->getReplacementCost();
 								}
 							}
 						}
@@ -1052,23 +1052,19 @@ void GameLogic::logicMessageDispatcher( GameMessage *msg, void *userData )
 						if (componentName.isEmpty())
 						{
 							// Replace all damaged components
-							std::vector<Component> components = obj->getComponents();
-							for (std::vector<Component>::const_iterator compIt = components.begin();
+							const std::vector<Component*>& components = body->getComponents();
+							for (std::vector<Component*>::const_iterator compIt = components.begin();
 								 compIt != components.end(); ++compIt)
 							{
-								const Component& component = *compIt;
-								if (component.getReplacementCost() > 0)
+								Component* comp = *compIt;
+								if (comp->getReplacementCost() > 0)
 								{
 									// Only replace if component is damaged
-									if (component.getCurrentHealth() < component.getCurrentMaxHealth())
+									if (comp->getCurrentHealth() < comp->getCurrentMaxHealth())
 									{
-										Component* comp = body->GetComponent<Component>(component.getName());
-										if (comp)
-										{
-											comp->setCurrentHealth(comp->getCurrentMaxHealth());
-											// TheSuperHackers @feature author 15/01/2025 Update model state after component replacement
-											body->setCorrectDamageState();
-										}
+										comp->setCurrentHealth(comp->getCurrentMaxHealth());
+										// TheSuperHackers @feature author 15/01/2025 Update model state after component replacement
+										body->setCorrectDamageState();
 									}
 								}
 							}
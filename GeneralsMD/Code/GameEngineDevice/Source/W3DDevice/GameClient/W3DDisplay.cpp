@@ -280,6 +280,11 @@ void StatDumpClass::dumpStats( Bool brief, Bool flagSpikes )
 	fprintf( m_fp, "  Particle Systems: %d\n", TheParticleSystemManager->getParticleSystemCount() );
 	Int totalParticles = TheParticleSystemManager->getParticleCount();
 	fprintf( m_fp, "  Particles: %d in world (%d onscreen)\n", totalParticles, onScreenParticleCount );
+	UnsignedInt particlesUpdated;
+	double particleUpdateTime;
+	TheParticleSystemManager->getUpdateStats( particlesUpdated, particleUpdateTime );
+	fprintf( m_fp, "  Particle update: %d particles in %.5f msec (%.0f per second)\n", particlesUpdated, particleUpdateTime,
+		particleUpdateTime > 0.0 ? (double)particlesUpdated * 1000.0 / particleUpdateTime : 0.0 );
 
   if ( flagSpikes && totalParticles > TheGlobalData->m_maxParticleCount - 10 )
   	fprintf( m_fp, "                                                                      PARTICLES OUT OF TOLERANCE(CAP-10)\n" );
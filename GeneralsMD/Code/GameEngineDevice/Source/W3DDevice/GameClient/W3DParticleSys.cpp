@@ -145,14 +145,8 @@ void W3DParticleSystemManager::doParticles(RenderInfoClass &rinfo)
 	if (TheSmudgeManager)
 		set=TheSmudgeManager->addSmudgeSet();	//global smudge set through which all smudges are rendered.
 
-	ParticleSystemManager::ParticleSystemList &particleSysList = TheParticleSystemManager->getAllParticleSystems();
-	for( ParticleSystemManager::ParticleSystemListIt it = particleSysList.begin(); it != particleSysList.end(); ++it)
+	for( ParticleSystem *sys = TheParticleSystemManager->getFirstParticleSystem(); sys; sys = sys->getNextParticleSystem() )
 	{
-		ParticleSystem *sys = (*it);
-		if (!sys) {
-			continue;
-		}
-
 		// only look at particle/point style systems
 		if (sys->isUsingDrawables())
 			continue;
@@ -0,0 +1,159 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: INICacheBuilder.cpp //////////////////////////////////////////////////////////////////////
+// Desc:   Builds the pre-tokenized INI cache (Data\INI\INICache.bin) offline, so the first launch
+//         with -iniCache does not have to read the INI text either.
+//
+// Usage:  inicachebuilder [-rebuild]
+//         Run from the game directory. Without -rebuild, entries that are still valid are kept.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/ArchiveFileSystem.h"
+#include "Common/Debug.h"
+#include "Common/FileSystem.h"
+#include "Common/GameMemory.h"
+#include "Common/GlobalData.h"
+#include "Common/INI.h"
+#include "Common/INICache.h"
+#include "Common/LocalFileSystem.h"
+#include "Common/NameKeyGenerator.h"
+#include "Common/SubsystemInterface.h"
+#include "Win32Device/Common/Win32BIGFileSystem.h"
+#include "Win32Device/Common/Win32LocalFileSystem.h"
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////////////////////////
+static SubsystemInterfaceList _TheSubsystemList;
+
+template<class SUBSYSTEM>
+void initSubsystem(SUBSYSTEM*& sysref, SUBSYSTEM* sys)
+{
+	sysref = sys;
+	_TheSubsystemList.initSubsystem(sys, nullptr, nullptr, nullptr);
+}
+
+// PUBLIC DATA ////////////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = nullptr;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = nullptr;
+
+const char *gAppPrefix = "IC_";
+
+// Where are the default string files?
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	Bool rebuild = FALSE;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (stricmp(argv[i], "-rebuild") == 0)
+			rebuild = TRUE;
+	}
+
+	int result = 0;
+
+	// initialize the memory manager early
+	initMemoryManager();
+
+	try
+	{
+		TheNameKeyGenerator = new NameKeyGenerator;
+		TheNameKeyGenerator->init();
+
+		TheFileSystem = new FileSystem;
+		TheWritableGlobalData = new GlobalData;
+
+		initSubsystem(TheLocalFileSystem, (LocalFileSystem*)new Win32LocalFileSystem);
+		initSubsystem(TheArchiveFileSystem, (ArchiveFileSystem*)new Win32BIGFileSystem);
+
+		TheINICache = new INICache;
+		if (!rebuild)
+			TheINICache->load(INICache::getDefaultFilename());
+
+		FilenameList filenameList;
+		TheFileSystem->getFileListInDirectory("Data\\INI\\", "*.ini", filenameList, TRUE);
+
+		const UnsignedInt loadedEntries = TheINICache->getEntryCount();
+		UnsignedInt failed = 0;
+
+		for (FilenameList::const_iterator it = filenameList.begin(); it != filenameList.end(); ++it)
+		{
+			try
+			{
+				INI ini;
+				ini.cacheFile(*it);
+			}
+			catch (...)
+			{
+				printf("Failed to read %s\n", it->str());
+				++failed;
+			}
+		}
+
+		printf("%d INI files found, %d cache entries loaded, %d cache entries written\n",
+			(Int)filenameList.size(), (Int)loadedEntries, (Int)TheINICache->getEntryCount());
+
+		if (!TheINICache->save(INICache::getDefaultFilename()))
+		{
+			printf("Could not write %s\n", INICache::getDefaultFilename());
+			result = 1;
+		}
+		else if (failed != 0)
+		{
+			result = 1;
+		}
+
+		delete TheINICache;
+		TheINICache = nullptr;
+
+		_TheSubsystemList.shutdownAll();
+
+		delete TheWritableGlobalData;
+		TheWritableGlobalData = nullptr;
+
+		delete TheFileSystem;
+		TheFileSystem = nullptr;
+
+		delete TheNameKeyGenerator;
+		TheNameKeyGenerator = nullptr;
+	}
+	catch (...)
+	{
+		printf("INICacheBuilder failed\n");
+		result = 1;
+	}
+
+	shutdownMemoryManager();
+
+	return result;
+}